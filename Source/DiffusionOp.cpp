@@ -177,9 +177,8 @@ void DiffusionOp::diffuse_scalar(Vector<MultiFab*> const& a_phi, int phi_comp,
       Vector<MultiFab> component;
       Vector<MultiFab> rhs;
 
-      // Allow for component specific LinOp BC
-      m_scal_solve_op->setDomainBC(m_pelelm->getDiffusionLinOpBC(Orientation::low,a_bcrec[comp]),
-                                   m_pelelm->getDiffusionLinOpBC(Orientation::high,a_bcrec[comp]));
+      // Allow for component specific LinOp BC, on each component of the block
+      setDomainBCs(*m_scal_solve_op, a_bcrec, comp);
 
       // Set aliases and bcoeff comp
       for (int lev = 0; lev <= finest_level; ++lev) {
@@ -227,6 +226,14 @@ void DiffusionOp::diffuse_scalar(Vector<MultiFab*> const& a_phi, int phi_comp,
 
       // Solve
       mlmg.solve(GetVecOfPtrs(component), GetVecOfConstPtrs(rhs), m_mg_rtol, m_mg_atol);
+      if (m_mg_log_iters) {
+         Print() << "   DiffusionOp solve: " << mlmg.getNumIters() << " MG iterations\n";
+      }
+
+      // Per-component convergence of the blocked solve
+      if (m_mg_comp_conv_check && m_ncomp > 1) {
+         checkCompConvergence(mlmg, component, rhs, comp);
+      }
 
       // Need to get the fluxes
       if ( have_fluxes ) {
@@ -366,9 +373,8 @@ void DiffusionOp::diffuse_scalar(Vector<MultiFab*> const& a_phi, int phi_comp,
       Vector<MultiFab> component;
       Vector<MultiFab> rhs;
 
-      // Allow for component specific LinOp BC
-      m_scal_solve_op->setDomainBC(m_pelelm->getDiffusionLinOpBC(Orientation::low,a_bcrec[comp]),
-                                   m_pelelm->getDiffusionLinOpBC(Orientation::high,a_bcrec[comp]));
+      // Allow for component specific LinOp BC, on each component of the block
+      setDomainBCs(*m_scal_solve_op, a_bcrec, comp);
 
       // Set aliases and bcoeff comp
       for (int lev = 0; lev <= finest_level; ++lev) {
@@ -415,6 +421,14 @@ void DiffusionOp::diffuse_scalar(Vector<MultiFab*> const& a_phi, int phi_comp,
 
       // Solve
       mlmg.solve(GetVecOfPtrs(component), GetVecOfConstPtrs(rhs), m_mg_rtol, m_mg_atol);
+      if (m_mg_log_iters) {
+         Print() << "   DiffusionOp solve: " << mlmg.getNumIters() << " MG iterations\n";
+      }
+
+      // Per-component convergence of the blocked solve
+      if (m_mg_comp_conv_check && m_ncomp > 1) {
+         checkCompConvergence(mlmg, component, rhs, comp);
+      }
 
       // Need to get the fluxes
       if ( have_fluxes ) {
@@ -590,9 +604,8 @@ void DiffusionOp::computeDiffFluxes(Vector<Array<MultiFab*,AMREX_SPACEDIM>> cons
       Vector<MultiFab> component;
       Vector<MultiFab> laps;
 
-      // Allow for component specific LinOp BC
-      m_scal_apply_op->setDomainBC(m_pelelm->getDiffusionLinOpBC(Orientation::low,a_bcrec[comp]),
-                                   m_pelelm->getDiffusionLinOpBC(Orientation::high,a_bcrec[comp]));
+      // Allow for component specific LinOp BC, on each component of the block
+      setDomainBCs(*m_scal_apply_op, a_bcrec, comp);
 
       for (int lev = 0; lev <= finest_level; ++lev) {
          for (int idim = 0; idim < AMREX_SPACEDIM; idim++ ) {
@@ -704,9 +717,8 @@ void DiffusionOp::computeDiffFluxes(Vector<Array<MultiFab*,AMREX_SPACEDIM>> cons
       Vector<MultiFab> component;
       Vector<MultiFab> laps;
 
-      // Allow for component specific LinOp BC
-      m_scal_apply_op->setDomainBC(m_pelelm->getDiffusionLinOpBC(Orientation::low,a_bcrec[comp]),
-                                   m_pelelm->getDiffusionLinOpBC(Orientation::high,a_bcrec[comp]));
+      // Allow for component specific LinOp BC, on each component of the block
+      setDomainBCs(*m_scal_apply_op, a_bcrec, comp);
 
       for (int lev = 0; lev <= finest_level; ++lev) {
          for (int idim = 0; idim < AMREX_SPACEDIM; idim++ ) {
@@ -833,6 +845,75 @@ DiffusionOp::readParameters ()
    pp.query("max_iter", m_mg_max_iter);
    pp.query("bottom_solver", m_mg_bottom_solver);
    pp.query("max_order", m_mg_maxorder);
+   pp.query("comp_convergence_check", m_mg_comp_conv_check);
+   pp.query("log_iters", m_mg_log_iters);
+}
+
+void
+DiffusionOp::setDomainBCs (MLLinOp& a_op,
+                           Vector<BCRec> const& a_bcrec,
+                           int a_comp)
+{
+   if (m_ncomp == 1) {
+      a_op.setDomainBC(m_pelelm->getDiffusionLinOpBC(Orientation::low,a_bcrec[a_comp]),
+                       m_pelelm->getDiffusionLinOpBC(Orientation::high,a_bcrec[a_comp]));
+      return;
+   }
+
+   // Blocked operator: one set of LinOp BCs per component
+   AMREX_ASSERT(a_bcrec.size() >= a_comp+m_ncomp);
+   Vector<Array<LinOpBCType,AMREX_SPACEDIM>> lobc(m_ncomp);
+   Vector<Array<LinOpBCType,AMREX_SPACEDIM>> hibc(m_ncomp);
+   for (int n = 0; n < m_ncomp; ++n) {
+      lobc[n] = m_pelelm->getDiffusionLinOpBC(Orientation::low,a_bcrec[a_comp+n]);
+      hibc[n] = m_pelelm->getDiffusionLinOpBC(Orientation::high,a_bcrec[a_comp+n]);
+   }
+   a_op.setDomainBC(lobc,hibc);
+}
+
+void
+DiffusionOp::checkCompConvergence (MLMG& a_mlmg,
+                                   Vector<MultiFab>& a_sol,
+                                   Vector<MultiFab>& a_rhs,
+                                   int a_comp)
+{
+   BL_PROFILE("DiffusionOp::checkCompConvergence()");
+
+   int finest_level = m_pelelm->finestLevel();
+
+   // Residual of the converged blocked system
+   Vector<MultiFab> res(finest_level+1);
+   for (int lev = 0; lev <= finest_level; ++lev) {
+      res[lev].define(a_rhs[lev].boxArray(), a_rhs[lev].DistributionMap(),
+                      m_ncomp, 0, MFInfo(), a_rhs[lev].Factory());
+   }
+   a_mlmg.compResidual(GetVecOfPtrs(res), GetVecOfPtrs(a_sol), GetVecOfConstPtrs(a_rhs));
+
+   // Max norm over levels of each component of the residual and RHS, single reduction
+   Vector<Real> norms(2*m_ncomp,0.0);
+   for (int lev = 0; lev <= finest_level; ++lev) {
+      for (int n = 0; n < m_ncomp; ++n) {
+         norms[n]         = std::max(norms[n], res[lev].norm0(n,0,true));
+         norms[m_ncomp+n] = std::max(norms[m_ncomp+n], a_rhs[lev].norm0(n,0,true));
+      }
+   }
+   ParallelDescriptor::ReduceRealMax(norms.data(), 2*m_ncomp);
+
+   int nUnconverged = 0;
+   for (int n = 0; n < m_ncomp; ++n) {
+      const Real tol = std::max(m_mg_rtol*norms[m_ncomp+n], m_mg_atol);
+      const bool converged = norms[n] <= tol;
+      if (!converged) nUnconverged++;
+      if (m_mg_comp_conv_check > 1 || !converged) {
+         Print() << "   DiffusionOp comp " << a_comp+n << ": resid " << norms[n]
+                 << ", rhs " << norms[m_ncomp+n]
+                 << (converged ? "" : " NOT CONVERGED") << "\n";
+      }
+   }
+   if (nUnconverged > 0) {
+      Print() << "   DiffusionOp: " << nUnconverged << " of " << m_ncomp
+              << " components above tolerance in blocked solve\n";
+   }
 }
 
 //---------------------------------------------------------------------------------------
@@ -1038,11 +1119,52 @@ void DiffusionTensorOp::compute_divtau (Vector<MultiFab*> const& a_divtau,
    }
 }
 
+#ifdef AMREX_USE_EB
+MLEBTensorOp*
+#else
+MLTensorOp*
+#endif
+DiffusionTensorOp::getSolveOp (int a_baseLevel)
+{
+   if (a_baseLevel == 0) return m_solve_op.get();
+
+   // Operator on the levels above a_baseLevel only, rebuilt with the DiffusionTensorOp on regrid
+   if (!m_partial_solve_op || m_partial_base != a_baseLevel) {
+      int finest_level = m_pelelm->finestLevel();
+      auto bcRecVel = m_pelelm->fetchBCRecArray(VELX,AMREX_SPACEDIM);
+
+      LPInfo info_solve;
+      info_solve.setMaxCoarseningLevel(m_mg_max_coarsening_level);
+
+#ifdef AMREX_USE_EB
+      Vector<EBFArrayBoxFactory const*> ebfactVec;
+      for (int lev = a_baseLevel; lev <= finest_level; ++lev) {
+          ebfactVec.push_back(&(m_pelelm->EBFactory(lev)));
+      }
+      m_partial_solve_op.reset(new MLEBTensorOp(m_pelelm->Geom(a_baseLevel,finest_level),
+                                                m_pelelm->boxArray(a_baseLevel,finest_level),
+                                                m_pelelm->DistributionMap(a_baseLevel,finest_level),
+                                                info_solve,ebfactVec));
+#else
+      m_partial_solve_op.reset(new MLTensorOp(m_pelelm->Geom(a_baseLevel,finest_level),
+                                              m_pelelm->boxArray(a_baseLevel,finest_level),
+                                              m_pelelm->DistributionMap(a_baseLevel,finest_level),
+                                              info_solve));
+#endif
+      m_partial_solve_op->setMaxOrder(m_mg_maxorder);
+      m_partial_solve_op->setDomainBC(m_pelelm->getDiffusionTensorOpBC(Orientation::low,bcRecVel),
+                                      m_pelelm->getDiffusionTensorOpBC(Orientation::high,bcRecVel));
+      m_partial_base = a_baseLevel;
+   }
+   return m_partial_solve_op.get();
+}
+
 void DiffusionTensorOp::diffuse_velocity (Vector<MultiFab*> const& a_vel,
                                           Vector<MultiFab const*> const& a_density,
                                           Vector<MultiFab const*> const& a_beta,
                                           const BCRec &a_bcrec,
-                                          Real a_dt)
+                                          Real a_dt,
+                                          int a_baseLevel)
 {
 
    const int finest_level = m_pelelm->finestLevel();
@@ -1051,13 +1173,21 @@ void DiffusionTensorOp::diffuse_velocity (Vector<MultiFab*> const& a_vel,
 
    AMREX_ASSERT( (!m_pelelm->m_incompressible && have_density) ||
                  (m_pelelm->m_incompressible && !have_density) );
+   AMREX_ASSERT( a_baseLevel >= 0 && a_baseLevel <= finest_level );
 
-   m_solve_op->setScalars(1.0, a_dt);
-   for (int lev = 0; lev <= finest_level; ++lev) {
+   // Levels below a_baseLevel are already updated and only provide the coarse-fine BC
+   auto* solve_op = getSolveOp(a_baseLevel);
+   if (a_baseLevel > 0) {
+      solve_op->setCoarseFineBC(a_vel[a_baseLevel-1], m_pelelm->refRatio(a_baseLevel-1)[0]);
+   }
+
+   solve_op->setScalars(1.0, a_dt);
+   for (int lev = a_baseLevel; lev <= finest_level; ++lev) {
+       const int mglev = lev - a_baseLevel;
        if ( have_density ) {
-          m_solve_op->setACoeffs(lev, *a_density[lev]);
+          solve_op->setACoeffs(mglev, *a_density[lev]);
        } else {
-          m_solve_op->setACoeffs(lev, m_pelelm->m_rho);
+          solve_op->setACoeffs(mglev, m_pelelm->m_rho);
        }
        int doZeroVisc = 0;
        int addTurbContrib = 1;
@@ -1065,16 +1195,16 @@ void DiffusionTensorOp::diffuse_velocity (Vector<MultiFab*> const& a_vel,
                                                                          doZeroVisc, {a_bcrec}, *a_beta[lev],
                                                                          addTurbContrib);
 #ifdef AMREX_USE_EB
-       m_solve_op->setShearViscosity(lev, GetArrOfConstPtrs(beta_ec), MLMG::Location::FaceCentroid);
-       m_solve_op->setEBShearViscosity(lev, *a_beta[lev]);
+       solve_op->setShearViscosity(mglev, GetArrOfConstPtrs(beta_ec), MLMG::Location::FaceCentroid);
+       solve_op->setEBShearViscosity(mglev, *a_beta[lev]);
 #else
-       m_solve_op->setShearViscosity(lev, GetArrOfConstPtrs(beta_ec));
+       solve_op->setShearViscosity(mglev, GetArrOfConstPtrs(beta_ec));
 #endif
-       m_solve_op->setLevelBC(lev, a_vel[lev]);
+       solve_op->setLevelBC(mglev, a_vel[lev]);
    }
 
    Vector<MultiFab> rhs(finest_level+1);
-   for (int lev = 0; lev <= finest_level; ++lev) {
+   for (int lev = a_baseLevel; lev <= finest_level; ++lev) {
        rhs[lev].define(a_vel[lev]->boxArray(),
                        a_vel[lev]->DistributionMap(), AMREX_SPACEDIM, 0);
 #ifdef AMREX_USE_OMP
@@ -1099,7 +1229,7 @@ void DiffusionTensorOp::diffuse_velocity (Vector<MultiFab*> const& a_vel,
        }
     }
 
-    MLMG mlmg(*m_solve_op);
+    MLMG mlmg(*solve_op);
 
     // Maximum iterations for MultiGrid / ConjugateGradients
     mlmg.setMaxIter(m_mg_max_iter);
@@ -1113,7 +1243,15 @@ void DiffusionTensorOp::diffuse_velocity (Vector<MultiFab*> const& a_vel,
     mlmg.setPreSmooth(m_num_pre_smooth);
     mlmg.setPostSmooth(m_num_post_smooth);
 
-    mlmg.solve(a_vel, GetVecOfConstPtrs(rhs), m_mg_rtol, m_mg_atol);
+    Vector<MultiFab*> sol(a_vel.begin()+a_baseLevel, a_vel.end());
+    Vector<MultiFab const*> rhs_p(finest_level+1-a_baseLevel);
+    for (int lev = a_baseLevel; lev <= finest_level; ++lev) {
+       rhs_p[lev-a_baseLevel] = &rhs[lev];
+    }
+    mlmg.solve(sol, rhs_p, m_mg_rtol, m_mg_atol);
+    if (m_mg_log_iters) {
+       Print() << "   DiffusionTensorOp solve: " << mlmg.getNumIters() << " MG iterations\n";
+    }
 }
 
 void
@@ -1130,4 +1268,5 @@ DiffusionTensorOp::readParameters ()
    pp.query("mg_max_fmg_iter",m_mg_max_fmg_iter);
    pp.query("num_pre_smooth",m_num_pre_smooth);
    pp.query("num_post_smooth",m_num_post_smooth);
+   pp.query("log_iters", m_mg_log_iters);
 }
@@ -68,6 +68,22 @@ PeleLM::getLevelDataReactPtr(int lev)
    }
 }
 
+PeleLM::ChemBAData*
+PeleLM::getChemBADataPtr(int lev)
+{
+   // Chemistry DMap can be updated by load balancing without regrid:
+   // rebuild the buffers whenever the chemistry layout changed
+   if ( !m_chemBAData[lev] ||
+        m_chemBAData[lev]->state.DistributionMap() != *m_dmapChem[lev] ||
+        m_chemBAData[lev]->state.boxArray() != *m_baChem[lev] ||
+        m_chemBAData[lev]->stateTemp.DistributionMap() != dmap[lev] ||
+        m_chemBAData[lev]->stateTemp.boxArray() != grids[lev] ) {
+      m_chemBAData[lev].reset(new ChemBAData(*m_baChem[lev], *m_dmapChem[lev],
+                                             grids[lev], dmap[lev], nCompForcing()));
+   }
+   return m_chemBAData[lev].get();
+}
+
 Vector<std::unique_ptr<MultiFab> >
 PeleLM::getStateVect(const TimeStamp &a_time) {
    Vector<std::unique_ptr<MultiFab> > r;
@@ -7,6 +7,9 @@ using namespace amrex;
 void PeleLM::Advance(int is_initIter) {
    BL_PROFILE("PeleLM::Advance()");
 
+   // The state is about to change
+   invalidateFillPatchCache();
+
 #ifdef AMREX_MEM_PROFILING
    // Memory profiler if compiled
    MemProfiler::report("STEP ["+std::to_string(m_nstep)+"]");
@@ -58,12 +61,17 @@ void PeleLM::Advance(int is_initIter) {
       amrex::Print() << " STEP [" << m_nstep << "] - Time: " << m_cur_time << ", dt " << m_dt << "\n";
    }
 
+   // Reset the deltaT iteration statistics
+   m_deltaTIterStepCount = 0;
+   m_deltaTIterStepSaved = 0;
+
    checkMemory("Adv. start");
 
    //----------------------------------------------------------------
    // Data for the advance, only live for the duration of the advance
    std::unique_ptr<AdvanceDiffData> diffData;
-   diffData.reset(new AdvanceDiffData(finest_level, grids, dmap, m_factory, m_nGrowAdv, m_use_wbar, m_use_soret));
+   diffData.reset(new AdvanceDiffData(finest_level, grids, dmap, m_factory, m_nGrowAdv, m_use_wbar, m_use_soret,
+                                      0, m_diffWarmStart));
    std::unique_ptr<AdvanceAdvData> advData;
    advData.reset(new AdvanceAdvData(finest_level, grids, dmap, m_factory, m_incompressible,
                                     m_nGrowAdv, m_nGrowMAC));
@@ -94,9 +102,8 @@ void PeleLM::Advance(int is_initIter) {
    fillPatchState(AmrOldTime);
 
    // compute t^{n} data
-   calcViscosity(AmrOldTime);
+   calcTransport(AmrOldTime);
    if (! m_incompressible ) {
-      calcDiffusivity(AmrOldTime);
 #ifdef PELE_USE_EFIELD
       poissonSolveEF(AmrOldTime);
 #endif
@@ -228,8 +235,19 @@ void PeleLM::Advance(int is_initIter) {
       m_pOld = m_pNew;
    }
 
+   // Accumulate time-integrated entropy generation
+   if (!is_initIter) {
+      updateEntropyGenAverage(m_dt);
+   }
+
    //----------------------------------------------------------------
    // Wrapup advance
+   // DeltaT iterations statistics
+   if (m_deltaT_verbose && m_deltaTAndersonDepth > 0) {
+      amrex::Print() << " >> DeltaT iterations: " << m_deltaTIterStepCount
+                     << ", estimated saved by Anderson acceleration: " << m_deltaTIterStepSaved << "\n";
+   }
+
    // Timing current time step
    if (m_verbose > 0)
    {
@@ -332,6 +332,58 @@ PeleLM::fillPatchReact(int lev, Real a_time, int nGrow) {
 
    return mf;
 }
+
+const MultiFab&
+PeleLM::fillPatchStateCached(int lev, Real a_time, int nGrow) {
+   return fillPatchCached(m_fpStateCache[lev], 0, lev, a_time, nGrow);
+}
+
+const MultiFab&
+PeleLM::fillPatchReactCached(int lev, Real a_time, int nGrow) {
+   return fillPatchCached(m_fpReactCache[lev], 1, lev, a_time, nGrow);
+}
+
+const MultiFab&
+PeleLM::fillPatchCached(FillPatchCacheEntry& a_entry, int a_isReact,
+                        int lev, Real a_time, int nGrow) {
+   // Reuse the entry if it holds enough ghost cells at that time on the current grids
+   if (m_use_fillPatchCache && a_entry.mf && a_entry.time == a_time &&
+       a_entry.mf->nGrow() >= nGrow &&
+       a_entry.mf->boxArray() == grids[lev] &&
+       a_entry.mf->DistributionMap() == dmap[lev]) {
+      m_fpCacheHits++;
+      m_fpCacheTimeSaved += a_entry.fillTime;
+      return *a_entry.mf;
+   }
+
+   BL_PROFILE("PeleLM::fillPatchCached()");
+   Real fillStart = ParallelDescriptor::second();
+   a_entry.mf = (a_isReact) ? fillPatchReact(lev, a_time, nGrow)
+                            : fillPatchState(lev, a_time, nGrow);
+   a_entry.time = a_time;
+   a_entry.fillTime = ParallelDescriptor::second() - fillStart;
+   m_fpCacheMisses++;
+   return *a_entry.mf;
+}
+
+void
+PeleLM::invalidateFillPatchCache() {
+   // Fine levels fillpatch from the coarse ones: drop all the levels at once
+   for (auto& entry : m_fpStateCache) {
+      entry.mf.reset();
+   }
+   for (auto& entry : m_fpReactCache) {
+      entry.mf.reset();
+   }
+}
+
+void
+PeleLM::reportFillPatchCache() {
+   Real timeSaved = m_fpCacheTimeSaved;
+   ParallelDescriptor::ReduceRealMax(timeSaved, ParallelDescriptor::IOProcessorNumber());
+   Print() << " Derive fillpatch cache: " << m_fpCacheHits << " hits, "
+           << m_fpCacheMisses << " fills, ~" << timeSaved << " s of fillpatch saved\n";
+}
 //-----------------------------------------------------------------------------
 
 // Fill the state
@@ -648,6 +700,36 @@ void PeleLM::fillpatch_reaction(int lev,
    }
 }
 
+// Fill the entropy generation running sum
+void PeleLM::fillpatch_entropyGen(int lev,
+                                  const amrex::Real a_time,
+                                  amrex::MultiFab &a_sgenSum,
+                                  int nGhost) {
+   ProbParm const* lprobparm = prob_parm_d;
+   if (lev == 0) {
+      PhysBCFunct<GpuBndryFuncFab<PeleLMCCFillExtDirDummy>> bndry_func(geom[lev], {m_bcrec_force},
+                                                                     PeleLMCCFillExtDirDummy{lprobparm, m_nAux});
+      FillPatchSingleLevel(a_sgenSum, IntVect(nGhost), a_time,
+                           {m_entropyGenSum[lev].get()},{a_time},
+                           0, 0, NUM_ENTROPYGEN, geom[lev], bndry_func, 0);
+   } else {
+
+      // Time-integrated quantity: always use conservative interpolation
+      auto* mapper = getInterpolator(1);
+
+      PhysBCFunct<GpuBndryFuncFab<PeleLMCCFillExtDirDummy>> crse_bndry_func(geom[lev-1], {m_bcrec_force},
+                                                                            PeleLMCCFillExtDirDummy{lprobparm, m_nAux});
+      PhysBCFunct<GpuBndryFuncFab<PeleLMCCFillExtDirDummy>> fine_bndry_func(geom[lev], {m_bcrec_force},
+                                                                            PeleLMCCFillExtDirDummy{lprobparm, m_nAux});
+      FillPatchTwoLevels(a_sgenSum, IntVect(nGhost), a_time,
+                         {m_entropyGenSum[lev-1].get()},{a_time},
+                         {m_entropyGenSum[lev].get()},{a_time},
+                         0, 0, NUM_ENTROPYGEN, geom[lev-1], geom[lev],
+                         crse_bndry_func,0,fine_bndry_func,0,
+                         refRatio(lev-1), mapper, {m_bcrec_force}, 0);
+   }
+}
+
 // Fill functC
 void PeleLM::fillpatch_chemFunctCall(int lev,
                                      const amrex::Real a_time,
@@ -770,6 +852,27 @@ void PeleLM::fillcoarsepatch_reaction(int lev,
                          refRatio(lev-1), mapper, {m_bcrec_force}, 0);
 }
 
+// Fill coarse patch of the entropy generation running sum
+void PeleLM::fillcoarsepatch_entropyGen(int lev,
+                                        const amrex::Real a_time,
+                                        amrex::MultiFab &a_sgenSum,
+                                        int nGhost) {
+   ProbParm const* lprobparm = prob_parm_d;
+
+   // Time-integrated quantity: always use conservative interpolation
+   auto* mapper = getInterpolator(1);
+
+   PhysBCFunct<GpuBndryFuncFab<PeleLMCCFillExtDirDummy>> crse_bndry_func(geom[lev-1], {m_bcrec_force},
+                                                                         PeleLMCCFillExtDirDummy{lprobparm, m_nAux});
+   PhysBCFunct<GpuBndryFuncFab<PeleLMCCFillExtDirDummy>> fine_bndry_func(geom[lev], {m_bcrec_force},
+                                                                         PeleLMCCFillExtDirDummy{lprobparm, m_nAux});
+   InterpFromCoarseLevel(a_sgenSum, IntVect(nGhost), a_time,
+                         *m_entropyGenSum[lev-1], 0, 0, NUM_ENTROPYGEN,
+                         geom[lev-1], geom[lev],
+                         crse_bndry_func,0,fine_bndry_func,0,
+                         refRatio(lev-1), mapper, {m_bcrec_force}, 0);
+}
+
 // Fill coarse patch of chem function call
 void PeleLM::fillcoarsepatch_chemFunctCall(int lev,
                                            const amrex::Real a_time,
@@ -26,6 +26,9 @@ PeleLM::LevelData::LevelData(amrex::BoxArray const& ba,
      }
    }
    if (! a_incompressible ) {
+      if (a_do_les) {
+         cp_cc.define(ba, dm, 1             , 1           , MFInfo(), factory);
+      }
       if (a_has_divu) {
          divu.define (ba, dm, 1             , 1           , MFInfo(), factory);
       }
@@ -58,6 +61,23 @@ PeleLM::LevelDataReact::LevelDataReact(const amrex::BoxArray &ba,
    functC.define(ba, dm, 1, 0, MFInfo(), factory);
 }
 
+PeleLM::ChemBAData::ChemBAData(const amrex::BoxArray &baChem,
+                               const amrex::DistributionMapping &dmChem,
+                               const amrex::BoxArray &ba,
+                               const amrex::DistributionMapping &dm,
+                               int a_nCompForcing)
+{
+   state.define(baChem, dmChem, NUM_SPECIES+3, 0);
+   forcing.define(baChem, dmChem, a_nCompForcing, 0);
+   functC.define(baChem, dmChem, 1, 0);
+   mask.define(baChem, dmChem, 1, 0);
+   frozen.define(baChem, dmChem, 1, 0);
+   stateTemp.define(ba, dm, NUM_SPECIES+3, 0);
+#ifdef PELE_USE_EFIELD
+   nE.define(baChem, dmChem, 1, 0);
+#endif
+}
+
 #ifdef PELE_USE_EFIELD
 PeleLM::LevelDataNLSolve::LevelDataNLSolve(amrex::BoxArray const& ba,
                                            amrex::DistributionMapping const& dm,
@@ -82,7 +102,8 @@ PeleLM::AdvanceDiffData::AdvanceDiffData(int a_finestLevel,
                                          const amrex::Vector<std::unique_ptr<amrex::FabFactory<FArrayBox>>> &factory,
                                          int nGrowAdv,
                                          int a_use_wbar, int a_use_soret,
-                                         int is_init)
+                                         int is_init,
+                                         int a_warmStart)
 {
    if (is_init) {                   // All I need is a container for a single diffusion term
       // Resize Vectors
@@ -101,6 +122,9 @@ PeleLM::AdvanceDiffData::AdvanceDiffData(int a_finestLevel,
          Dwbar.resize(a_finestLevel+1);
          wbar_fluxes.resize(a_finestLevel+1);
       }
+      if ( a_warmStart ) {
+         Ysolve.resize(a_finestLevel+1);
+      }
       if ( a_use_soret) {
          DT.resize(a_finestLevel+1);
          soret_fluxes.resize(a_finestLevel+1);
@@ -118,6 +142,9 @@ PeleLM::AdvanceDiffData::AdvanceDiffData(int a_finestLevel,
                wbar_fluxes[lev][idim].define(faceba,dm[lev], NUM_SPECIES, 0, MFInfo(), *factory[lev]);
             }
          }
+         if (a_warmStart) {
+            Ysolve[lev].define(ba[lev], dm[lev], std::max(a_warmStart,2)*NUM_SPECIES, 0, MFInfo(), *factory[lev]);
+         }
          if (a_use_soret) {
            DT[lev].define(ba[lev], dm[lev], NUM_SPECIES, nGrowAdv, MFInfo(), *factory[lev]);
            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
@@ -215,6 +242,8 @@ PeleLM::copyStateOldToNew(int nGhost) {
 void
 PeleLM::copyTransportOldToNew() {
    for (int lev = 0; lev <= finest_level; lev++ ) {
+      invalidateFaceCoeffCache(lev, &m_leveldata_new[lev]->visc_cc);
+      invalidateFaceCoeffCache(lev, &m_leveldata_new[lev]->diff_cc);
       MultiFab::Copy(m_leveldata_new[lev]->visc_cc,m_leveldata_old[lev]->visc_cc,0,0,1,1);
       if ( !m_incompressible ) {
          MultiFab::Copy(m_leveldata_new[lev]->diff_cc,m_leveldata_old[lev]->diff_cc,0,0,NUM_SPECIES+2,1);
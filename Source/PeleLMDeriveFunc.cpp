@@ -1093,8 +1093,8 @@ void pelelm_derdmap (PeleLM* /*a_pelelm*/, const Box& bx, FArrayBox& derfab, int
 // Compute EITERM4
 //
 void pelelm_derEIterm4 (PeleLM* a_pelelm, const Box& bx, FArrayBox& derfab, int dcomp, int ncomp,
-                            const FArrayBox& statefab, const FArrayBox& reactfab, const FArrayBox& /*pressfab*/,
-                            const Geometry& geomdata,
+                            const FArrayBox& statefab, const FArrayBox& /*reactfab*/, const FArrayBox& /*pressfab*/,
+                            const Geometry& /*geomdata*/,
                             Real /*time*/, const Vector<BCRec>& /*bcrec*/, int /*level*/)
 
 {
@@ -1103,141 +1103,289 @@ void pelelm_derEIterm4 (PeleLM* a_pelelm, const Box& bx, FArrayBox& derfab, int
     AMREX_ASSERT(derfab.nComp() >= dcomp + ncomp);
     AMREX_ASSERT(!a_pelelm->m_incompressible);
 
-    FArrayBox EnthFab;
-    EnthFab.resize(bx,NUM_SPECIES,The_Async_Arena());
+    // Reaction stoichiometry in CSR format, built once in derivedSetup()
+    AMREX_ASSERT(a_pelelm->m_stoichRowPtr.size() == NUM_REACTIONS+1);
+    const int*         rowPtr  = a_pelelm->m_stoichRowPtr.data();
+    const int*         specIdx = a_pelelm->m_stoichSpecIdx.data();
+    const amrex::Real* nuCoef  = a_pelelm->m_stoichCoef.data();
 
-    auto const dat = statefab.const_array(); 
-    auto const react = reactfab.const_array(0);
-    auto const& Hi    = EnthFab.array();
+    auto const rho  = statefab.const_array(DENSITY);
+    auto const rhoY = statefab.const_array(FIRSTSPEC);
+    auto const T    = statefab.const_array(TEMP);
     auto       EI = derfab.array(dcomp);
     amrex::ParallelFor(bx,
     [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
     {
-      EI(i,j,k) = 0.0;
-      amrex::Real massfrac[NUM_SPECIES];
-      amrex::Real gibbs_fe[NUM_SPECIES] = {0.0};
-      amrex::Real gibbs_standard[NUM_SPECIES] = {0.0};
-      amrex::Real prod_rate[NUM_SPECIES] = {0.0};
-      
-      amrex::Real rho = dat(i, j, k, DENSITY);
-      amrex::Real rhoInv = 1/rho;
-      // Get rate of production of each species
-      amrex::Real sc[NUM_SPECIES] = {0.0};
-      for (int n = 0; n < NUM_SPECIES; n++) {
-	massfrac[n] = dat(i, j, k, FIRSTSPEC + n) * rhoInv;
-        sc[n] = rho * massfrac[n] *imw(n);
-      }
-      CKYTCR(rho,rho,massfrac, sc); //Need species concentration first
-      
-      // Get chemical potential, or molar gibbs
-      
-      amrex::Real tc[5]={0.0};
-      tc[0]= std::log(dat(i,j,k,TEMP));
-      tc[1]=dat(i,j,k,TEMP);
-      tc[2]=tc[1]*tc[1];
-      tc[3]=tc[2]*tc[1];
-      tc[4]=tc[3]*tc[1];
-      gibbs(gibbs_fe, tc);
-      for (int n = 0; n < NUM_SPECIES; n++) {
-	gibbs_standard[n] = 8.31446 * dat(i,j,k,TEMP) * gibbs_fe[n];
-	gibbs_fe[n] += std::log(std::max(sc[n]*8.31446 * dat(i,j,k,TEMP)/101325,std::numeric_limits<double>::epsilon()));
-	gibbs_fe[n] *= 8.31446 * dat(i,j,k,TEMP);
-	
-      }
-      for (int ii = 0; ii < NUM_SPECIES; ii++) { 
-	sc[ii] *= 1e6; // in SI units for productionRate
-      }
-      productionRate(prod_rate, sc, dat(i,j,k,TEMP));
-      EI(i,j,k) = 0.0;
-      
-      // for (int ii = 0; ii < NUM_SPECIES; ii++) { 
-      // 	EI(i,j,k)+=prod_rate[ii]*gibbs_fe[ii];
-	
-      // }
-      amrex::Real q_f_temp[NUM_REACTIONS] = {0.0};
-      amrex::Real q_r_temp[NUM_REACTIONS] = {0.0};
-      amrex::Real q_f[NUM_REACTIONS] = {0.0};
-      amrex::Real q_r[NUM_REACTIONS] = {0.0};
-      amrex::Real prod_rate_2[NUM_SPECIES] = {0.0};
-      amrex::Real wdot[NUM_REACTIONS] = {0.0};
-      amrex::Real nu_spec = 0.0;
-      int nspec = 0;
-      int& nspecr = nspec;
-      int* temp;
-      int* temp2;
-      CKINU(0, nspecr, temp, temp2);
-      int ki[nspec] = {0};
-      int nu[nspec] = {0};
-      int* kip = ki;
-      int* nup = nu;
-      int rmap[NUM_REACTIONS] = {0};
-      int* rmapp = rmap;
-      GET_RMAP(rmapp);
-      for (int ii = 0; ii < NUM_SPECIES; ii++) { 
-      	sc[ii] *= 1e-6; // in SI units for productionRate
-      }
-      comp_qfqr(q_f_temp, q_r_temp, sc,sc,tc,1.0/tc[1]);
-      
-      for (int n = 0; n < NUM_REACTIONS; n++) { 
-       
-       	q_f[rmap[n]] = q_f_temp[n];
-       	q_r[rmap[n]] = q_r_temp[n];
+      EI(i,j,k) = getChemEntropyProd(i, j, k, rho, rhoY, T, rowPtr, specIdx, nuCoef, nullptr, true);
+    });
+}
 
-      }
-      double DG_j[NUM_REACTIONS] = {0.0};
-      double DG_j_s[NUM_REACTIONS] = {0.0};
-      double EI_j[NUM_REACTIONS] = {0.0};
-      bool skip = false;
-      double EImin = 0.0;
-      int EIminInd = 0;
-      for (int n = 0; n < NUM_REACTIONS; n++) {
-	skip = false;
-      	CKINU(n+1, nspecr, kip, nup);
-      	wdot[n] = 1e-6 * (q_f[n] - q_r[n]);
-      	for (int m = 0; m < nspec; m++){
-      	  DG_j[n] += nu[m] * gibbs_fe[ki[m]-1];
-      	  DG_j_s[n] += nu[m] * gibbs_standard[ki[m]-1];
-	  if (sc[ki[m]-1] < 0.0){
-	    skip = true;
-	  }
-      	}
-	
-	EI_j[n] = wdot[n] * DG_j[n];
-	
-	if (!skip){
-	  if (EI_j[n] < EImin){
-	    EImin = EI_j[n];
-	    EIminInd = n;
-	  }
-	  EI(i,j,k) += EI_j[n];
-	}
-      }
-#if DUMPDATA==true
-      const amrex::Real* prob_lo = geomdata.ProbLo();
-      const amrex::Real* prob_hi = geomdata.ProbHi();
-      const amrex::Real* dx      = geomdata.CellSize();
-      
-      auto eos = pele::physics::PhysicsType::eos();
-      amrex::Real x[AMREX_SPACEDIM] = {0.0};
-      AMREX_D_TERM( x[0] = prob_lo[0] + (i+0.5)*dx[0];,
-		    x[1] = prob_lo[1] + (j+0.5)*dx[1];,
-		    x[2] = prob_lo[2] + (k+0.5)*dx[2];);
-      
-      // Open the file in append mode
-      std::ofstream file("data.txt", std::ios::app);
-      
-      // Check if the file is opened successfully
-      if (!file.is_open()) {
-        std::cerr << "Error opening the file!" << std::endl;
-      }
-      
-      // Append the data row to the file
-      file << x[0] << ", " << x[1] << ", " << dat(i,j,k,DENSITY) << ", " << dat(i,j,k,TEMP)<< std::endl;
-      
-      // Close the file
-      file.close();
 
+//
+// Compute the local entropy generation budget:
+// heat conduction, viscous dissipation, species diffusion and chemistry
+// When available, the new-time diffusion face fluxes and viscosity of the
+// advance are reused, otherwise the transport properties are evaluated here
+//
+void pelelm_derentropygen (PeleLM* a_pelelm, const Box& bx, FArrayBox& derfab, int dcomp, int ncomp,
+                           const FArrayBox& statefab, const FArrayBox& /*reactfab*/, const FArrayBox& /*pressfab*/,
+                           const Geometry& geom,
+                           Real time, const Vector<BCRec>& /*bcrec*/, int level)
+
+{
+    AMREX_ASSERT(derfab.box().contains(bx));
+    AMREX_ASSERT(statefab.box().contains(amrex::grow(bx,1)));
+    AMREX_ASSERT(derfab.nComp() >= dcomp + ncomp);
+    AMREX_ASSERT(ncomp == 4);
+    AMREX_ASSERT(!a_pelelm->m_incompressible);
+
+#ifdef AMREX_USE_EB
+    const EBFArrayBox& ebfab = static_cast<EBFArrayBox const&>(statefab);
+    const EBCellFlagFab& flags = ebfab.getEBCellFlagFab();
+    if (flags.getType(bx) == FabType::covered) {
+        derfab.setVal<RunOn::Device>(0.0,bx,dcomp,ncomp);
+        return;
+    }
 #endif
+
+    const auto dxinv = geom.InvCellSizeArray();
+
+    // Reaction stoichiometry in CSR format, built once in derivedSetup()
+    AMREX_ASSERT(a_pelelm->m_stoichRowPtr.size() == NUM_REACTIONS+1);
+    const int*         rowPtr  = a_pelelm->m_stoichRowPtr.data();
+    const int*         specIdx = a_pelelm->m_stoichSpecIdx.data();
+    const amrex::Real* nuCoef  = a_pelelm->m_stoichCoef.data();
+
+    auto const vel  = statefab.const_array(VELX);
+    auto const rho  = statefab.const_array(DENSITY);
+    auto const rhoY = statefab.const_array(FIRSTSPEC);
+    auto const T    = statefab.const_array(TEMP);
+    auto       sgen = derfab.array(dcomp);
+
+    // Reuse the face fluxes: heat conduction and species diffusion terms are evaluated
+    // on the faces, consistently with the discrete diffusion operator, and averaged to the cell
+    amrex::GpuArray<amrex::Array4<const amrex::Real>,AMREX_SPACEDIM> fluxes;
+    amrex::Array4<const amrex::Real> visc;
+    if (a_pelelm->getEntropyDiffFluxes(level, time, bx, fluxes, visc)) {
+        amrex::ParallelFor(bx,
+        [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+        {
+            auto eos = pele::physics::PhysicsType::eos();
+            amrex::Real mwtinv[NUM_SPECIES] = {0.0};
+            eos.inv_molecular_weight(mwtinv);
+            constexpr amrex::Real Ru = 8.31446;        // J/mol/K
+            constexpr amrex::Real Yfloor = 1.0e-12;
+
+            // Log of the mass fractions and mean molecular weight of the cell
+            const amrex::Real Tloc = T(i,j,k);
+            amrex::Real lnY[NUM_SPECIES] = {0.0};
+            amrex::Real invWbar = 0.0;
+            {
+                const amrex::Real rhoinv = 1.0 / rho(i,j,k);
+                for (int n = 0; n < NUM_SPECIES; n++) {
+                    const amrex::Real y = rhoY(i,j,k,n) * rhoinv;
+                    lnY[n] = std::log(amrex::max(y, Yfloor));
+                    invWbar += y * mwtinv[n];
+                }
+            }
+
+            amrex::Real gradU[AMREX_SPACEDIM][AMREX_SPACEDIM] = {{0.0}};
+            amrex::Real sgen_heat = 0.0;
+            amrex::Real sgen_diff = 0.0;
+            for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
+                const int ip = i + (dir == 0), im = i - (dir == 0);
+                const int jp = j + (dir == 1), jm = j - (dir == 1);
+                const int kp = k + (dir == 2), km = k - (dir == 2);
+                auto const& flux = fluxes[dir];
+                for (int c = 0; c < AMREX_SPACEDIM; c++) {
+                    gradU[c][dir] = 0.5 * dxinv[dir] * (vel(ip,jp,kp,c) - vel(im,jm,km,c));
+                }
+
+                // Low (side = 0) and high (side = 1) faces
+                for (int side = 0; side < 2; side++) {
+                    const int fi = (side == 0) ? i : ip, ni = (side == 0) ? im : ip;
+                    const int fj = (side == 0) ? j : jp, nj = (side == 0) ? jm : jp;
+                    const int fk = (side == 0) ? k : kp, nk = (side == 0) ? km : kp;
+                    const amrex::Real sgn = (side == 0) ? 1.0 : -1.0;  // Cell minus neighbor, along +dir
+
+                    // - q . grad(T) / T^2 with q = - lambda grad(T)
+                    const amrex::Real q = flux(fi,fj,fk,NUM_SPECIES);
+                    if (q != 0.0) {
+                        const amrex::Real Tface = 0.5 * (Tloc + T(ni,nj,nk));
+                        sgen_heat -= 0.5 * q * sgn * (Tloc - T(ni,nj,nk)) * dxinv[dir] / (Tface * Tface);
+                    }
+
+                    // - R/W_k j_k . grad(ln X_k), with W_k in kg/mol
+                    const amrex::Real rhoinv_n = 1.0 / rho(ni,nj,nk);
+                    amrex::Real invWbar_n = 0.0;
+                    for (int n = 0; n < NUM_SPECIES; n++) {
+                        invWbar_n += rhoY(ni,nj,nk,n) * rhoinv_n * mwtinv[n];
+                    }
+                    const amrex::Real dlnWbar = std::log(invWbar_n / invWbar);
+                    for (int n = 0; n < NUM_SPECIES; n++) {
+                        const amrex::Real jk = flux(fi,fj,fk,n);
+                        if (jk == 0.0) continue;
+                        const amrex::Real lnY_n = std::log(amrex::max(rhoY(ni,nj,nk,n) * rhoinv_n, Yfloor));
+                        const amrex::Real gradLnX = sgn * (lnY[n] - lnY_n + dlnWbar) * dxinv[dir];
+                        sgen_diff -= 0.5 * Ru * mwtinv[n] * 1.0e3 * jk * gradLnX;
+                    }
+                }
+            }
+
+            // Viscous dissipation: mu / T * (2 S:S - 2/3 (div u)^2)
+            amrex::Real divu = 0.0;
+            amrex::Real twoSS = 0.0;
+            for (int a = 0; a < AMREX_SPACEDIM; a++) {
+                divu += gradU[a][a];
+                for (int b = 0; b < AMREX_SPACEDIM; b++) {
+                    twoSS += 0.5 * (gradU[a][b] + gradU[b][a]) * (gradU[a][b] + gradU[b][a]);
+                }
+            }
+            const amrex::Real sgen_visc = visc(i,j,k) / Tloc * (twoSS - 2.0 / 3.0 * divu * divu);
+
+            // Chemistry: - 1/T sum_j wdot_j DG_j
+            const amrex::Real sgen_chem = - getChemEntropyProd(i, j, k, rho, rhoY, T, rowPtr, specIdx, nuCoef) / Tloc;
+
+            sgen(i,j,k,0) = sgen_heat;
+            sgen(i,j,k,1) = sgen_visc;
+            sgen(i,j,k,2) = sgen_diff;
+            sgen(i,j,k,3) = sgen_chem;
+        });
+        return;
+    }
+
+    auto const* ltransparm = a_pelelm->trans_parms.device_trans_parm();
+    const amrex::Real ScInv = a_pelelm->m_Schmidt_inv;
+    const amrex::Real PrInv = a_pelelm->m_Prandtl_inv;
+    const int unity_Le = a_pelelm->m_unity_Le;
+    const int use_wbar = a_pelelm->m_use_wbar;
+    const int use_soret = a_pelelm->m_use_soret;
+
+    amrex::ParallelFor(bx,
+    [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+    {
+        auto eos = pele::physics::PhysicsType::eos();
+        amrex::Real mwtinv[NUM_SPECIES] = {0.0};
+        eos.inv_molecular_weight(mwtinv);
+
+        // Local composition
+        const amrex::Real rholoc = rho(i,j,k);
+        const amrex::Real rhoinv = 1.0 / rholoc;
+        const amrex::Real Tloc = T(i,j,k);
+        amrex::Real y[NUM_SPECIES] = {0.0};
+        for (int n = 0; n < NUM_SPECIES; n++) {
+            y[n] = rhoY(i,j,k,n) * rhoinv;
+        }
+        amrex::Real Wbar = 0.0;
+        eos.Y2WBAR(y, Wbar);
+
+        // Transport coefficients, evaluated once for all the terms (MKS)
+        amrex::Real rhoD[NUM_SPECIES] = {0.0};
+        amrex::Real rhotheta[NUM_SPECIES] = {0.0};
+        amrex::Real lambda = 0.0;
+        amrex::Real mu = 0.0;
+        {
+            amrex::Real rhoD_cgs[NUM_SPECIES] = {0.0};
+            amrex::Real chi[NUM_SPECIES] = {0.0};
+            amrex::Real lambda_cgs = 0.0;
+            amrex::Real mu_cgs = 0.0;
+            amrex::Real dummy_xi = 0.0;
+            amrex::Real rho_cgs = rholoc * 1.0e-3;
+            bool get_xi = false;
+            bool get_mu = true;
+            bool get_lam = !unity_Le;
+            bool get_Ddiag = !unity_Le;
+            bool get_chi = use_soret;
+            auto trans = pele::physics::PhysicsType::transport();
+            trans.transport(get_xi, get_mu, get_lam, get_Ddiag, get_chi, Tloc,
+                            rho_cgs, y, rhoD_cgs, chi, mu_cgs, dummy_xi, lambda_cgs, ltransparm);
+            mu = mu_cgs * 1.0e-1;
+            if (unity_Le) {
+                amrex::Real cpmix = 0.0;
+                eos.TY2Cp(Tloc, y, cpmix);
+                lambda = mu_cgs * PrInv * cpmix * 1.0e-5;
+                for (int n = 0; n < NUM_SPECIES; n++) {
+                    rhoD[n] = mu * ScInv;
+                }
+            } else {
+                lambda = lambda_cgs * 1.0e-5;
+                for (int n = 0; n < NUM_SPECIES; n++) {
+                    rhoD[n] = rhoD_cgs[n] * Wbar * mwtinv[n] * 1.0e-1;
+                    rhotheta[n] = - rhoD_cgs[n] * 1.0e-1 * chi[n];
+                }
+            }
+        }
+
+        // Centered gradients, accumulating the heat conduction and species diffusion terms
+        // direction by direction such that species gradients are not stored
+        constexpr amrex::Real Ru = 8.31446;        // J/mol/K
+        constexpr amrex::Real Yfloor = 1.0e-12;
+        amrex::Real gradU[AMREX_SPACEDIM][AMREX_SPACEDIM] = {{0.0}};
+        amrex::Real sgen_heat = 0.0;
+        amrex::Real sgen_diff = 0.0;
+        for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
+            const int ip = i + (dir == 0), im = i - (dir == 0);
+            const int jp = j + (dir == 1), jm = j - (dir == 1);
+            const int kp = k + (dir == 2), km = k - (dir == 2);
+            const amrex::Real fac = 0.5 * dxinv[dir];
+
+            const amrex::Real gradT = fac * (T(ip,jp,kp) - T(im,jm,km));
+            for (int c = 0; c < AMREX_SPACEDIM; c++) {
+                gradU[c][dir] = fac * (vel(ip,jp,kp,c) - vel(im,jm,km,c));
+            }
+            sgen_heat += lambda * gradT * gradT / (Tloc * Tloc);
+
+            // Species fluxes, including Wbar and Soret contributions and the correction velocity
+            const amrex::Real rhoinv_p = 1.0 / rho(ip,jp,kp);
+            const amrex::Real rhoinv_m = 1.0 / rho(im,jm,km);
+            amrex::Real gradY[NUM_SPECIES] = {0.0};
+            amrex::Real invWbar_p = 0.0;
+            amrex::Real invWbar_m = 0.0;
+            for (int n = 0; n < NUM_SPECIES; n++) {
+                const amrex::Real y_p = rhoY(ip,jp,kp,n) * rhoinv_p;
+                const amrex::Real y_m = rhoY(im,jm,km,n) * rhoinv_m;
+                gradY[n] = fac * (y_p - y_m);
+                invWbar_p += y_p * mwtinv[n];
+                invWbar_m += y_m * mwtinv[n];
+            }
+            const amrex::Real gradWbarOverWbar = fac * (1.0 / invWbar_p - 1.0 / invWbar_m) / Wbar;
+            amrex::Real flux[NUM_SPECIES] = {0.0};
+            amrex::Real sumFlux = 0.0;
+            for (int n = 0; n < NUM_SPECIES; n++) {
+                flux[n] = - rhoD[n] * gradY[n];
+                if (use_wbar) {
+                    flux[n] -= rhoD[n] * y[n] * gradWbarOverWbar;
+                }
+                if (use_soret) {
+                    flux[n] -= rhotheta[n] * gradT / Tloc;
+                }
+                sumFlux += flux[n];
+            }
+            for (int n = 0; n < NUM_SPECIES; n++) {
+                flux[n] -= y[n] * sumFlux;
+                // - R/W_k j_k . grad(ln X_k), with W_k in kg/mol
+                const amrex::Real gradLnX = gradY[n] / amrex::max(y[n], Yfloor) + gradWbarOverWbar;
+                sgen_diff -= Ru * mwtinv[n] * 1.0e3 * flux[n] * gradLnX;
+            }
+        }
+
+        // Viscous dissipation: mu / T * (2 S:S - 2/3 (div u)^2)
+        amrex::Real divu = 0.0;
+        amrex::Real twoSS = 0.0;
+        for (int a = 0; a < AMREX_SPACEDIM; a++) {
+            divu += gradU[a][a];
+            for (int b = 0; b < AMREX_SPACEDIM; b++) {
+                twoSS += 0.5 * (gradU[a][b] + gradU[b][a]) * (gradU[a][b] + gradU[b][a]);
+            }
+        }
+        const amrex::Real sgen_visc = mu / Tloc * (twoSS - 2.0 / 3.0 * divu * divu);
+
+        // Chemistry: - 1/T sum_j wdot_j DG_j
+        const amrex::Real sgen_chem = - getChemEntropyProd(i, j, k, rho, rhoY, T, rowPtr, specIdx, nuCoef) / Tloc;
+
+        sgen(i,j,k,0) = sgen_heat;
+        sgen(i,j,k,1) = sgen_visc;
+        sgen(i,j,k,2) = sgen_diff;
+        sgen(i,j,k,3) = sgen_chem;
     });
 }
-
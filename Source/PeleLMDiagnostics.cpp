@@ -1,4 +1,5 @@
 #include <PeleLM.H>
+#include <algorithm>
 
 using namespace amrex;
 
@@ -63,29 +64,52 @@ void
 PeleLM::doDiagnostics()
 {
     BL_PROFILE("PeleLM::doDiagnostics()");
-    // Assemble a vector of MF containing the requested data
+
+    // Find the diagnostics due this step and the variables they need
+    Vector<int> doDiag(m_diagnostics.size(),0);
+    Vector<std::string> dueVars;
+    for (int n = 0; n < m_diagnostics.size(); ++n) {
+        if ( m_diagnostics[n]->doDiag(m_cur_time, m_nstep) ) {
+            doDiag[n] = 1;
+            m_diagnostics[n]->addVars(dueVars);
+        }
+    }
+    if (dueVars.empty()) return;
+
+    Vector<int> needVar(m_diagVars.size(),0);
+    for (int v{0}; v < m_diagVars.size(); ++v ) {
+        needVar[v] = (std::find(dueVars.begin(), dueVars.end(), m_diagVars[v]) != dueVars.end()) ? 1 : 0;
+    }
+    const bool allNeeded = std::all_of(needVar.begin(), needVar.end(), [](int a) { return a == 1; });
+
+    // Assemble a vector of MF containing the requested data, keeping the m_diagVars layout
+    // Components of the same multi-component derive are derived once and sliced
     Vector<std::unique_ptr<MultiFab> > diagMFVec(finestLevel()+1);
     for (int lev{0}; lev <= finestLevel(); ++lev) {
         diagMFVec[lev] = std::make_unique<MultiFab>(grids[lev], dmap[lev], m_diagVars.size(), 1);
+        if (!allNeeded) diagMFVec[lev]->setVal(0.0);
+        Vector<int> done(m_diagVars.size(),0);
         for (int v{0}; v < m_diagVars.size(); ++v ) {
-            std::unique_ptr<MultiFab> mf;
-            mf = derive(m_diagVars[v], m_cur_time, lev, 1);
-            // If the variable is a derive component, get its index from the derive multifab
-            // TODO: if multiple diagVars are components of the same derive, they get redundantly derived each time
-            int mf_idx = 0;
+            if (!needVar[v] || done[v]) continue;
             const PeleLMDeriveRec* rec = derive_lst.get(m_diagVars[v]);
-            if (rec) mf_idx = rec->variableComp(m_diagVars[v]);
-            MultiFab::Copy(*diagMFVec[lev].get(), *mf, mf_idx, v, 1, 1);
+            std::unique_ptr<MultiFab> mf = derive(m_diagVars[v], m_cur_time, lev, 1);
+            if (rec) {
+                // derive returns all the components of rec: copy each needed one
+                for (int w{v}; w < m_diagVars.size(); ++w ) {
+                    if (needVar[w] && !done[w] && derive_lst.get(m_diagVars[w]) == rec) {
+                        MultiFab::Copy(*diagMFVec[lev].get(), *mf, rec->variableComp(m_diagVars[w]), w, 1, 1);
+                        done[w] = 1;
+                    }
+                }
+            } else {
+                MultiFab::Copy(*diagMFVec[lev].get(), *mf, 0, v, 1, 1);
+                done[v] = 1;
+            }
         }
     }
 
-    Vector<std::string> stateNames;
-    for (std::list<std::tuple<int,std::string>>::const_iterator li = stateComponents.begin(),
-         End = stateComponents.end(); li != End; ++li) {
-       stateNames.push_back(get<1>(*li));
-    }
     for (int n = 0; n < m_diagnostics.size(); ++n) {
-        if ( m_diagnostics[n]->doDiag(m_cur_time, m_nstep) ) {
+        if ( doDiag[n] ) {
             m_diagnostics[n]->processDiag(m_nstep, m_cur_time,
                                           GetVecOfConstPtrs(diagMFVec),
                                           m_diagVars);
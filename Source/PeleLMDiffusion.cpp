@@ -14,15 +14,44 @@ using namespace amrex;
 DiffusionOp*
 PeleLM::getDiffusionOp()
 {
-   if (!m_diffusion_op) m_diffusion_op.reset(new DiffusionOp(this));
-   return m_diffusion_op.get();
+   return getMCDiffusionOp(1);
 }
 
 DiffusionOp*
 PeleLM::getMCDiffusionOp(int ncomp)
 {
-   if (!m_mcdiffusion_op || m_mcdiffusion_op->m_ncomp != ncomp) m_mcdiffusion_op.reset(new DiffusionOp(this,ncomp));
-   return m_mcdiffusion_op.get();
+   auto& op = m_diffusionOpPool[ncomp];
+   auto& stats = m_diffusionOpPoolStats[ncomp];
+   if (!op) {
+      Real buildStart = ParallelDescriptor::second();
+      op.reset(new DiffusionOp(this,ncomp));
+      Real buildTime = ParallelDescriptor::second() - buildStart;
+      ParallelDescriptor::ReduceRealMax(buildTime, ParallelDescriptor::IOProcessorNumber());
+      stats.misses++;
+      stats.buildTime += buildTime;
+      if (m_verbose > 2) {
+         Print() << "   Built DiffusionOp(ncomp=" << ncomp << ") in " << buildTime << " s\n";
+      }
+   } else {
+      stats.hits++;
+   }
+   return op.get();
+}
+
+void
+PeleLM::resetDiffusionOps()
+{
+   m_diffusionOpPool.clear();
+   m_diffusionTensor_op.reset();
+}
+
+void
+PeleLM::reportDiffusionOpPool()
+{
+   for (const auto& kv : m_diffusionOpPoolStats) {
+      Print() << " DiffusionOp(ncomp=" << kv.first << ") pool: " << kv.second.hits << " hits, "
+              << kv.second.misses << " builds, " << kv.second.buildTime << " s building\n";
+   }
 }
 
 DiffusionTensorOp*
@@ -98,6 +127,11 @@ void PeleLM::computeDifferentialDiffusionTerms(const TimeStamp &a_time,
                                          soretFluxVec);
    }
 
+   // Keep the new-time fluxes for the entropy_generation derive
+   if (m_keepEntropyDiffFluxes && a_time == AmrNewTime) {
+      storeEntropyDiffFluxes(GetVecOfArrOfPtrs(fluxes));
+   }
+
    // If doing species balances, compute face domain integrals
    // using level 0 since we've averaged down the fluxes already
    // Factor for SDC is 0.5 is for Dn and -0.5 for Dnp1
@@ -795,6 +829,112 @@ void PeleLM::computeSpeciesEnthalpyFlux(const Vector<Array<MultiFab*,AMREX_SPACE
    }
 }
 
+void PeleLM::fusedSpeciesFluxCorrections(const Vector<Array<MultiFab*,AMREX_SPACEDIM> > &a_fluxes,
+                                         std::unique_ptr<AdvanceDiffData> &diffData)
+{
+   BL_PROFILE("PeleLM::fusedSpeciesFluxCorrections()");
+
+   // Get the species BCRec
+   auto bcRecSpec = fetchBCRecArray(FIRSTSPEC,NUM_SPECIES);
+
+   for (int lev = 0; lev <= finest_level; ++lev) {
+
+      auto ldata_p = getLevelDataPtr(lev,AmrNewTime);
+
+      //------------------------------------------------------------------------
+      // Cell-centered species enthalpies, the only cell-centered intermediate
+      int nGrow = 1;
+      MultiFab Enth(grids[lev],dmap[lev],NUM_SPECIES,nGrow,MFInfo(),Factory(lev));
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+      for (MFIter mfi(Enth,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+      {
+         const Box& gbx  = mfi.growntilebox();
+         auto const& Temp_arr  = ldata_p->state.const_array(mfi,TEMP);
+         auto const& Hi_arr    = Enth.array(mfi);
+         amrex::ParallelFor(gbx, [Temp_arr, Hi_arr]
+         AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+         {
+            getHGivenT( i, j, k, Temp_arr, Hi_arr );
+         });
+      }
+
+      //------------------------------------------------------------------------
+      // One sweep per face box: lagged Wbar/Soret fluxes, zero-sum correction
+      // and \sum_k { \Flux_k * h_k }, with h_k averaged to the face on the fly
+      const Box& domain = geom[lev].Domain();
+      bool use_harmonic_avg = m_harm_avg_cen2edge ? true : false;
+      int use_wbar = m_use_wbar;
+      int use_soret = m_use_soret;
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+      for (MFIter mfi(Enth,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+      {
+         for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            const Box& ebx       = mfi.nodaltilebox(idim);
+            const Box& edomain   = amrex::surroundingNodes(domain,idim);
+            auto const& rhoY     = ldata_p->state.const_array(mfi,FIRSTSPEC);
+            auto const& enth     = Enth.const_array(mfi);
+            auto const& flux     = a_fluxes[lev][idim]->array(mfi);
+            auto const& flux_wbar  = (use_wbar) ? diffData->wbar_fluxes[lev][idim].const_array(mfi)
+                                                : a_fluxes[lev][idim]->const_array(mfi);    // Dummy unused Array4
+            auto const& flux_soret = (use_soret) ? diffData->soret_fluxes[lev][idim].const_array(mfi)
+                                                 : a_fluxes[lev][idim]->const_array(mfi);   // Dummy unused Array4
+            const auto bc_lo = bcRecSpec[0].lo(idim);
+            const auto bc_hi = bcRecSpec[0].hi(idim);
+            amrex::ParallelFor(ebx, [idim, rhoY, enth, flux, flux_wbar, flux_soret, edomain, bc_lo, bc_hi,
+                                     use_wbar, use_soret, use_harmonic_avg]
+            AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+               int idx[3] = {i,j,k};
+               bool on_lo = ( ( bc_lo == amrex::BCType::ext_dir ) &&
+                              ( idx[idim] <= edomain.smallEnd(idim) ) );
+               bool on_hi = ( ( bc_hi == amrex::BCType::ext_dir ) &&
+                              ( idx[idim] >= edomain.bigEnd(idim) ) );
+               // Same stencil as cen2edg_cpp/repair_flux
+               int  id_l[3] = {i,j,k};
+               int  id_h[3] = {i,j,k};
+               if ( !on_lo ) {
+                  if ( !on_hi ) {
+                     id_l[idim] -= 1;
+                  }
+               } else {
+                  id_l[idim] -= 1;
+                  id_h[idim] -= 1;
+               }
+
+               amrex::Real sumFlux = 0.0;
+               amrex::Real sumRhoYe = 0.0;
+               for (int n = 0; n < NUM_SPECIES; n++) {
+                  if (use_wbar) flux(i,j,k,n) += flux_wbar(i,j,k,n);
+                  if (use_soret) flux(i,j,k,n) += flux_soret(i,j,k,n);
+                  sumFlux += flux(i,j,k,n);
+                  sumRhoYe += 0.5 * (rhoY(id_l[0],id_l[1],id_l[2],n) + rhoY(id_h[0],id_h[1],id_h[2],n));
+               }
+               sumFlux /= sumRhoYe;
+
+               amrex::Real enthFlux = 0.0;
+               for (int n = 0; n < NUM_SPECIES; n++) {
+                  const amrex::Real rhoYe = 0.5 * (rhoY(id_l[0],id_l[1],id_l[2],n) + rhoY(id_h[0],id_h[1],id_h[2],n));
+                  flux(i,j,k,n) -= sumFlux * rhoYe;
+                  const amrex::Real h_l = enth(id_l[0],id_l[1],id_l[2],n);
+                  const amrex::Real h_h = enth(id_h[0],id_h[1],id_h[2],n);
+                  amrex::Real h_e = 0.5 * (h_l + h_h);
+                  if (use_harmonic_avg) {
+                     h_e = (h_l * h_h > 0.0) ? 2.0 * h_l * h_h / (h_l + h_h) : 0.0;
+                  }
+                  enthFlux += flux(i,j,k,n) * h_e;
+               }
+               flux(i,j,k,NUM_SPECIES+1) = enthFlux;
+            });
+         }
+      }
+   }
+}
+
 void PeleLM::differentialDiffusionUpdate(std::unique_ptr<AdvanceAdvData> &advData,
                                          std::unique_ptr<AdvanceDiffData> &diffData)
 {
@@ -855,6 +995,11 @@ void PeleLM::differentialDiffusionUpdate(std::unique_ptr<AdvanceAdvData> &advDat
    // Get the species BCRec
    auto bcRecSpec = fetchBCRecArray(FIRSTSPEC,NUM_SPECIES);
 
+   // Initial guess from the previous SDC iterations solutions
+   if (m_diffWarmStart) {
+      warmStartSpeciesDiffusion(diffData);
+   }
+
 #ifdef PELE_USE_EFIELD
    // Solve for \widetilda{rhoY^{np1,kp1}}
    // -> return the uncorrected fluxes^{np1,kp1}
@@ -890,69 +1035,105 @@ void PeleLM::differentialDiffusionUpdate(std::unique_ptr<AdvanceAdvData> &advDat
                                                  NUM_SPECIES, 0, m_dt);
 #endif
 
-   // Add lagged Wbar term
-   // Computed in computeDifferentialDiffusionTerms at t^{n} if first SDC iteration, t^{np1,k} otherwise
-   if (m_use_wbar) {
-      for (int lev = 0; lev <= finest_level; ++lev) {
+   if (m_diffWarmStart) {
+      storeSpeciesDiffusionSolution(diffData);
+   }
+
+   // Get the temperature BCRec
+   auto bcRecTemp = fetchBCRecArray(TEMP,1);
+
+#ifndef AMREX_USE_EB
+   // Fused path: the species fluxes corrections and the enthalpy flux in a single
+   // face sweep. Fourier fluxes only depend on T^{np1,k}, so all NUM_SPECIES+2
+   // components are averaged down and their divergence taken in one pass.
+   const bool fusedFluxes = m_use_fusedSpeciesFluxes;
+   if (fusedFluxes) {
+      // FillPatch the new species before computing flux correction terms
+      fillPatchSpecies(AmrNewTime);
+
+      fusedSpeciesFluxCorrections(GetVecOfArrOfPtrs(fluxes), diffData);
+
+      // Fourier: - \lambda \nabla T
+      int do_avgDown = 0;
+      getDiffusionOp()->computeDiffFluxes(GetVecOfArrOfPtrs(fluxes), NUM_SPECIES,
+                                          GetVecOfConstPtrs(getTempVect(AmrNewTime)), 0,
+                                          {},
+                                          GetVecOfConstPtrs(getDiffusivityVect(AmrNewTime)), NUM_SPECIES, bcRecTemp,
+                                          1, do_avgDown);
+
+      getDiffusionOp()->avgDownFluxes(GetVecOfArrOfPtrs(fluxes),0,NUM_SPECIES+2);
+
+      // Compute diffusion term D^{np1,kp1} (or Dhat) of species, Fourier and DifferentialDiffusion
+      fluxDivergence(GetVecOfPtrs(diffData->Dhat), 0, GetVecOfArrOfPtrs(fluxes), 0, NUM_SPECIES+2, 1, -1.0);
+   } else
+#else
+   const bool fusedFluxes = false;
+#endif
+   {
+      // Add lagged Wbar term
+      // Computed in computeDifferentialDiffusionTerms at t^{n} if first SDC iteration, t^{np1,k} otherwise
+      if (m_use_wbar) {
+         for (int lev = 0; lev <= finest_level; ++lev) {
 
-         auto ldata_p = getLevelDataPtr(lev,AmrNewTime);
+            auto ldata_p = getLevelDataPtr(lev,AmrNewTime);
 
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
-         for (MFIter mfi(ldata_p->state,TilingIfNotGPU()); mfi.isValid(); ++mfi)
-         {
-            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+            for (MFIter mfi(ldata_p->state,TilingIfNotGPU()); mfi.isValid(); ++mfi)
             {
-               const Box& ebx = mfi.nodaltilebox(idim);
-               auto const& flux_spec = fluxes[lev][idim].array(mfi);
-               auto const& flux_wbar = diffData->wbar_fluxes[lev][idim].const_array(mfi);
-               amrex::ParallelFor(ebx, NUM_SPECIES, [ flux_spec, flux_wbar ]
-               AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+               for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
                {
-                   flux_spec(i,j,k,n) += flux_wbar(i,j,k,n);
-               });
+                  const Box& ebx = mfi.nodaltilebox(idim);
+                  auto const& flux_spec = fluxes[lev][idim].array(mfi);
+                  auto const& flux_wbar = diffData->wbar_fluxes[lev][idim].const_array(mfi);
+                  amrex::ParallelFor(ebx, NUM_SPECIES, [ flux_spec, flux_wbar ]
+                  AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+                  {
+                      flux_spec(i,j,k,n) += flux_wbar(i,j,k,n);
+                  });
+               }
             }
          }
       }
-   }
-   if (m_use_soret) {
-     for (int lev = 0; lev <= finest_level; ++lev) {
-       auto ldata_p = getLevelDataPtr(lev,AmrNewTime);
+      if (m_use_soret) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+          auto ldata_p = getLevelDataPtr(lev,AmrNewTime);
 
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
-       for (MFIter mfi(ldata_p->state,TilingIfNotGPU()); mfi.isValid(); ++mfi)
-       {
-         for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
-           {
-             const Box& ebx = mfi.nodaltilebox(idim);
-             auto const& flux_spec = fluxes[lev][idim].array(mfi);
-             auto const& flux_soret = diffData->soret_fluxes[lev][idim].const_array(mfi);
-             amrex::ParallelFor(ebx, NUM_SPECIES, [ flux_spec, flux_soret ]
-                AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
-                {
-                  flux_spec(i,j,k,n) += flux_soret(i,j,k,n);
-                });
-           }
-       }
-     }
-   }
+          for (MFIter mfi(ldata_p->state,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+          {
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+              {
+                const Box& ebx = mfi.nodaltilebox(idim);
+                auto const& flux_spec = fluxes[lev][idim].array(mfi);
+                auto const& flux_soret = diffData->soret_fluxes[lev][idim].const_array(mfi);
+                amrex::ParallelFor(ebx, NUM_SPECIES, [ flux_spec, flux_soret ]
+                   AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+                   {
+                     flux_spec(i,j,k,n) += flux_soret(i,j,k,n);
+                   });
+              }
+          }
+        }
+      }
 
 
-   // FillPatch the new species before computing flux correction terms
-   fillPatchSpecies(AmrNewTime);
+      // FillPatch the new species before computing flux correction terms
+      fillPatchSpecies(AmrNewTime);
 
-   // Adjust species diffusion fluxes to ensure their sum is zero
-   adjustSpeciesFluxes(GetVecOfArrOfPtrs(fluxes),
-                       GetVecOfConstPtrs(getSpeciesVect(AmrNewTime)));
+      // Adjust species diffusion fluxes to ensure their sum is zero
+      adjustSpeciesFluxes(GetVecOfArrOfPtrs(fluxes),
+                          GetVecOfConstPtrs(getSpeciesVect(AmrNewTime)));
 
-   // Average down fluxes^{np1,kp1}
-   getDiffusionOp()->avgDownFluxes(GetVecOfArrOfPtrs(fluxes),0,NUM_SPECIES);
+      // Average down fluxes^{np1,kp1}
+      getDiffusionOp()->avgDownFluxes(GetVecOfArrOfPtrs(fluxes),0,NUM_SPECIES);
 
-   // Compute diffusion term D^{np1,kp1} (or Dhat)
-   fluxDivergence(GetVecOfPtrs(diffData->Dhat), 0, GetVecOfArrOfPtrs(fluxes), 0, NUM_SPECIES, 1, -1.0);
+      // Compute diffusion term D^{np1,kp1} (or Dhat)
+      fluxDivergence(GetVecOfPtrs(diffData->Dhat), 0, GetVecOfArrOfPtrs(fluxes), 0, NUM_SPECIES, 1, -1.0);
+   }
 
    // Update species
    // Remove the Wbar term because we included it in both the dhat and the forcing.
@@ -1001,58 +1182,58 @@ void PeleLM::differentialDiffusionUpdate(std::unique_ptr<AdvanceAdvData> &advDat
 
    //------------------------------------------------------------------------
    // Enthalpy iterative diffusion solve
-   // Get the temperature BCRec
-   auto bcRecTemp = fetchBCRecArray(TEMP,1);
-
-   // Fourier: - \lambda \nabla T
-   int do_avgDown = 0;
+   // Already done with the species fluxes in the fused path
+   if (!fusedFluxes) {
+      // Fourier: - \lambda \nabla T
+      int do_avgDown = 0;
 #ifdef AMREX_USE_EB
-   if (m_isothermalEB) {
-      // Set up EB dirichlet value and diffusivity
-      Vector<MultiFab> EBvalue(finest_level+1);
-      Vector<MultiFab> EBdiff(finest_level+1);
-      for (int lev = 0; lev <= finest_level; ++lev) {
-         EBvalue[lev].define(grids[lev],dmap[lev], 1, 0, MFInfo(), EBFactory(lev));
-         EBdiff[lev].define(grids[lev],dmap[lev], 1, 0, MFInfo(), EBFactory(lev));
-         getEBDiff(lev, AmrNewTime, EBdiff[lev], NUM_SPECIES);
-         getEBState(lev,getTime(lev,AmrNewTime),EBvalue[lev],TEMP,1);
-      }
-      getDiffusionOp()->computeDiffFluxes(GetVecOfArrOfPtrs(fluxes), NUM_SPECIES,
-                                          GetVecOfPtrs(EBfluxes), 0,
-                                          GetVecOfConstPtrs(getTempVect(AmrNewTime)), 0,
-                                          {},
-                                          GetVecOfConstPtrs(getDiffusivityVect(AmrNewTime)), NUM_SPECIES,
-                                          GetVecOfConstPtrs(EBvalue),
-                                          GetVecOfConstPtrs(EBdiff),
-                                          bcRecTemp, 1, do_avgDown);
-   } else
+      if (m_isothermalEB) {
+         // Set up EB dirichlet value and diffusivity
+         Vector<MultiFab> EBvalue(finest_level+1);
+         Vector<MultiFab> EBdiff(finest_level+1);
+         for (int lev = 0; lev <= finest_level; ++lev) {
+            EBvalue[lev].define(grids[lev],dmap[lev], 1, 0, MFInfo(), EBFactory(lev));
+            EBdiff[lev].define(grids[lev],dmap[lev], 1, 0, MFInfo(), EBFactory(lev));
+            getEBDiff(lev, AmrNewTime, EBdiff[lev], NUM_SPECIES);
+            getEBState(lev,getTime(lev,AmrNewTime),EBvalue[lev],TEMP,1);
+         }
+         getDiffusionOp()->computeDiffFluxes(GetVecOfArrOfPtrs(fluxes), NUM_SPECIES,
+                                             GetVecOfPtrs(EBfluxes), 0,
+                                             GetVecOfConstPtrs(getTempVect(AmrNewTime)), 0,
+                                             {},
+                                             GetVecOfConstPtrs(getDiffusivityVect(AmrNewTime)), NUM_SPECIES,
+                                             GetVecOfConstPtrs(EBvalue),
+                                             GetVecOfConstPtrs(EBdiff),
+                                             bcRecTemp, 1, do_avgDown);
+      } else
 #endif
-   {
-      getDiffusionOp()->computeDiffFluxes(GetVecOfArrOfPtrs(fluxes), NUM_SPECIES,
-                                          GetVecOfConstPtrs(getTempVect(AmrNewTime)), 0,
-                                          {},
-                                          GetVecOfConstPtrs(getDiffusivityVect(AmrNewTime)), NUM_SPECIES, bcRecTemp,
-                                          1, do_avgDown);
-   }
+      {
+         getDiffusionOp()->computeDiffFluxes(GetVecOfArrOfPtrs(fluxes), NUM_SPECIES,
+                                             GetVecOfConstPtrs(getTempVect(AmrNewTime)), 0,
+                                             {},
+                                             GetVecOfConstPtrs(getDiffusivityVect(AmrNewTime)), NUM_SPECIES, bcRecTemp,
+                                             1, do_avgDown);
+      }
 
-   // Differential diffusion term: \sum_k ( h_k * \Flux_k )
-   computeSpeciesEnthalpyFlux(GetVecOfArrOfPtrs(fluxes),
-                              GetVecOfConstPtrs(getTempVect(AmrNewTime)));
+      // Differential diffusion term: \sum_k ( h_k * \Flux_k )
+      computeSpeciesEnthalpyFlux(GetVecOfArrOfPtrs(fluxes),
+                                 GetVecOfConstPtrs(getTempVect(AmrNewTime)));
 
-   // average_down enthalpy fluxes
-   getDiffusionOp()->avgDownFluxes(GetVecOfArrOfPtrs(fluxes),NUM_SPECIES,2);
+      // average_down enthalpy fluxes
+      getDiffusionOp()->avgDownFluxes(GetVecOfArrOfPtrs(fluxes),NUM_SPECIES,2);
 
-   // Compute diffusion term D^{np1,kp1} of Fourier and DifferentialDiffusion
+      // Compute diffusion term D^{np1,kp1} of Fourier and DifferentialDiffusion
 #ifdef AMREX_USE_EB
-   if (m_isothermalEB) {
-      // Do Fourier with EBflux first then differential diffusion
-      fluxDivergence(GetVecOfPtrs(diffData->Dhat), NUM_SPECIES, GetVecOfArrOfPtrs(fluxes), NUM_SPECIES,
-                     GetVecOfPtrs(EBfluxes), 0, 1, 1, -1.0);
-      fluxDivergence(GetVecOfPtrs(diffData->Dhat), NUM_SPECIES+1, GetVecOfArrOfPtrs(fluxes), NUM_SPECIES+1, 1, 1, -1.0);
-   } else
+      if (m_isothermalEB) {
+         // Do Fourier with EBflux first then differential diffusion
+         fluxDivergence(GetVecOfPtrs(diffData->Dhat), NUM_SPECIES, GetVecOfArrOfPtrs(fluxes), NUM_SPECIES,
+                        GetVecOfPtrs(EBfluxes), 0, 1, 1, -1.0);
+         fluxDivergence(GetVecOfPtrs(diffData->Dhat), NUM_SPECIES+1, GetVecOfArrOfPtrs(fluxes), NUM_SPECIES+1, 1, 1, -1.0);
+      } else
 #endif
-   {
-      fluxDivergence(GetVecOfPtrs(diffData->Dhat), NUM_SPECIES, GetVecOfArrOfPtrs(fluxes), NUM_SPECIES, 2, 1, -1.0);
+      {
+         fluxDivergence(GetVecOfPtrs(diffData->Dhat), NUM_SPECIES, GetVecOfArrOfPtrs(fluxes), NUM_SPECIES, 2, 1, -1.0);
+      }
    }
 
    //------------------------------------------------------------------------
@@ -1072,8 +1253,34 @@ void PeleLM::differentialDiffusionUpdate(std::unique_ptr<AdvanceAdvData> &advDat
       RhoCp[lev].define(grids[lev],dmap[lev], 1, 0, MFInfo(), Factory(lev));
    }
 
+   // Anderson acceleration history
+   std::unique_ptr<DeltaTAndersonData> anderson;
+   if (m_deltaTAndersonDepth > 0) {
+      anderson = std::make_unique<DeltaTAndersonData>();
+      anderson->depth = m_deltaTAndersonDepth;
+      anderson->fPrev.resize(finest_level+1);
+      anderson->gPrev.resize(finest_level+1);
+      anderson->dF.resize(anderson->depth);
+      anderson->dG.resize(anderson->depth);
+      for (int lev = 0; lev <= finest_level; ++lev) {
+         anderson->fPrev[lev].define(grids[lev],dmap[lev], 1, 0, MFInfo(), Factory(lev));
+         anderson->gPrev[lev].define(grids[lev],dmap[lev], 1, 0, MFInfo(), Factory(lev));
+      }
+      for (int h = 0; h < anderson->depth; ++h) {
+         anderson->dF[h].resize(finest_level+1);
+         anderson->dG[h].resize(finest_level+1);
+         for (int lev = 0; lev <= finest_level; ++lev) {
+            anderson->dF[h][lev].define(grids[lev],dmap[lev], 1, 0, MFInfo(), Factory(lev));
+            anderson->dG[h][lev].define(grids[lev],dmap[lev], 1, 0, MFInfo(), Factory(lev));
+         }
+      }
+   }
+
    // DeltaT norm
    Real deltaT_norm = 0.0;
+   Real deltaT_norm0 = 0.0;    // First two norms, used to estimate the plain
+   Real deltaT_norm1 = 0.0;    // fixed-point convergence rate
+   int nDeltaTIter = 0;
    for (int dTiter = 0; dTiter < m_deltaTIterMax && (dTiter==0 || deltaT_norm >= m_deltaT_norm_max); ++dTiter) {
 
       // Prepare the deltaT iteration linear solve:
@@ -1131,7 +1338,7 @@ void PeleLM::differentialDiffusionUpdate(std::unique_ptr<AdvanceAdvData> &advDat
                            GetVecOfArrOfPtrs(fluxes),
                            GetVecOfPtrs(EBfluxes),
                            GetVecOfConstPtrs(Tsave),
-                           diffData, deltaT_norm);
+                           diffData, deltaT_norm, anderson.get());
       } else
 #endif
       {
@@ -1139,9 +1346,13 @@ void PeleLM::differentialDiffusionUpdate(std::unique_ptr<AdvanceAdvData> &advDat
                            GetVecOfArrOfPtrs(fluxes),
                            {},
                            GetVecOfConstPtrs(Tsave),
-                           diffData, deltaT_norm);
+                           diffData, deltaT_norm, anderson.get());
       }
 
+      nDeltaTIter = dTiter+1;
+      if (dTiter == 0) deltaT_norm0 = deltaT_norm;
+      if (dTiter == 1) deltaT_norm1 = deltaT_norm;
+
       // Check for convergence failure
       if ( (dTiter == m_deltaTIterMax-1) && ( deltaT_norm > m_deltaT_norm_max ) ) {
          if ( m_crashOnDeltaTFail ) {
@@ -1151,9 +1362,93 @@ void PeleLM::differentialDiffusionUpdate(std::unique_ptr<AdvanceAdvData> &advDat
          }
       }
    }
+
+   //------------------------------------------------------------------------
+   // Iteration statistics. The second iterate is not mixed yet, so the first two
+   // norms give the plain fixed-point contraction rate, from which the number of
+   // unaccelerated iterations is estimated.
+   m_deltaTIterStepCount += nDeltaTIter;
+   if (anderson && nDeltaTIter > 2 && deltaT_norm < m_deltaT_norm_max) {
+      int nPlainIter = m_deltaTIterMax;
+      const Real rate = deltaT_norm1 / deltaT_norm0;
+      if (rate > 0.0 && rate < 1.0) {
+         nPlainIter = 2 + static_cast<int>(std::ceil(std::log(m_deltaT_norm_max/deltaT_norm1)/std::log(rate)));
+         nPlainIter = std::min(nPlainIter, m_deltaTIterMax);
+      }
+      const int nSaved = std::max(0, nPlainIter - nDeltaTIter);
+      m_deltaTIterStepSaved += nSaved;
+      if (m_deltaT_verbose) {
+         Print() << "   DeltaT Anderson: " << nDeltaTIter << " iterations, ~"
+                 << nPlainIter << " without acceleration\n";
+      }
+   }
    //------------------------------------------------------------------------
 }
 
+void PeleLM::warmStartSpeciesDiffusion(std::unique_ptr<AdvanceDiffData> &diffData)
+{
+   if (diffData->nYsolve == 0) return;
+
+   BL_PROFILE("PeleLM::warmStartSpeciesDiffusion()");
+
+   // Constant extrapolation of the last solution, or linear (quadratic) extrapolation
+   // of the last two (three) if available and requested. Only the valid cells are
+   // seeded, the ghost cells carry the solve BCs.
+   const int order = std::min(m_diffWarmStart, diffData->nYsolve) - 1;
+   for (int lev = 0; lev <= finest_level; ++lev) {
+      auto ldata_p = getLevelDataPtr(lev,AmrNewTime);
+      auto const& sma = ldata_p->state.arrays();
+      auto const& yma = diffData->Ysolve[lev].const_arrays();
+      amrex::ParallelFor(diffData->Ysolve[lev], [=]
+      AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept
+      {
+         auto const& state = sma[box_no];
+         auto const& ysol  = yma[box_no];
+         for (int n = 0; n < NUM_SPECIES; n++) {
+            Real Yguess = ysol(i,j,k,n);
+            if (order == 1) {
+               Yguess = 2.0 * ysol(i,j,k,n) - ysol(i,j,k,NUM_SPECIES+n);
+            } else if (order == 2) {
+               Yguess = 3.0 * ysol(i,j,k,n) - 3.0 * ysol(i,j,k,NUM_SPECIES+n)
+                      + ysol(i,j,k,2*NUM_SPECIES+n);
+            }
+            state(i,j,k,FIRSTSPEC+n) = state(i,j,k,DENSITY) * Yguess;
+         }
+      });
+   }
+   Gpu::streamSynchronize();
+}
+
+void PeleLM::storeSpeciesDiffusionSolution(std::unique_ptr<AdvanceDiffData> &diffData)
+{
+   BL_PROFILE("PeleLM::storeSpeciesDiffusionSolution()");
+
+   // Shift the stored solutions and store the new one as mass fractions, since
+   // the density is updated between SDC iterations
+   const int nStore = diffData->Ysolve[0].nComp() / NUM_SPECIES;
+   const int nShift = std::min(diffData->nYsolve, nStore-1);
+   for (int lev = 0; lev <= finest_level; ++lev) {
+      auto ldata_p = getLevelDataPtr(lev,AmrNewTime);
+      auto const& sma = ldata_p->state.const_arrays();
+      auto const& yma = diffData->Ysolve[lev].arrays();
+      amrex::ParallelFor(diffData->Ysolve[lev], [=]
+      AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept
+      {
+         auto const& state = sma[box_no];
+         auto const& ysol  = yma[box_no];
+         const Real rhoinv = 1.0 / state(i,j,k,DENSITY);
+         for (int n = 0; n < NUM_SPECIES; n++) {
+            for (int m = nShift; m > 0; m--) {
+               ysol(i,j,k,m*NUM_SPECIES+n) = ysol(i,j,k,(m-1)*NUM_SPECIES+n);
+            }
+            ysol(i,j,k,n) = state(i,j,k,FIRSTSPEC+n) * rhoinv;
+         }
+      });
+   }
+   Gpu::streamSynchronize();
+   diffData->nYsolve = std::min(diffData->nYsolve+1, nStore);
+}
+
 void PeleLM::deltaTIter_prepare(const Vector<MultiFab*> &a_rhs,
                                 const Vector<MultiFab*> &a_Tsave,
                                 const Vector<MultiFab*> &a_rhoCp,
@@ -1215,7 +1510,8 @@ void PeleLM::deltaTIter_update(int a_dtiter,
                                const Vector<MultiFab* > &a_ebfluxes,
                                const Vector<MultiFab const*> &a_Tsave,
                                std::unique_ptr<AdvanceDiffData> &diffData,
-                               Real &a_deltaT_norm)
+                               Real &a_deltaT_norm,
+                               DeltaTAndersonData* a_anderson)
 {
 #ifndef AMREX_USE_EB
     amrex::ignore_unused(a_ebfluxes);
@@ -1234,6 +1530,11 @@ void PeleLM::deltaTIter_update(int a_dtiter,
       Print() << "   DeltaT solve norm [" << a_dtiter << "] = " << a_deltaT_norm << "\n";
    }
 
+   // Accelerate the fixed-point iteration, unless converged already
+   if (a_anderson && a_deltaT_norm >= m_deltaT_norm_max) {
+      deltaTIter_anderson(a_Tsave, *a_anderson);
+   }
+
    // FillPatch the new temperature before going into the fluxe computation
    fillPatchTemp(AmrNewTime);
 
@@ -1311,6 +1612,112 @@ void PeleLM::deltaTIter_update(int a_dtiter,
    Gpu::streamSynchronize();
 }
 
+void PeleLM::deltaTIter_anderson(const Vector<MultiFab const*> &a_Tsave,
+                                 DeltaTAndersonData &a_anderson)
+{
+   BL_PROFILE("PeleLM::deltaTIter_anderson()");
+
+   // The new temperature holds the fixed-point image g_k = T_k + deltaT_k and
+   // the deltaT residual is f_k = g_k - T_k. Store the differences with the
+   // previous iterate, then replace g_k by g_k - \sum_j gamma_j dG_j, where
+   // gamma minimizes || f_k - \sum_j gamma_j dF_j ||_2
+   // This is the only acceleration of the deltaT iterations: no Newton-Krylov
+   // variant is provided.
+   Vector<MultiFab> fk(finest_level+1);
+   for (int lev = 0; lev <= finest_level; ++lev) {
+      auto ldata_p = getLevelDataPtr(lev,AmrNewTime);
+      fk[lev].define(grids[lev],dmap[lev], 1, 0, MFInfo(), Factory(lev));
+      MultiFab::LinComb(fk[lev], 1.0, ldata_p->state, TEMP, -1.0, *a_Tsave[lev], 0, 0, 1, 0);
+      if (a_anderson.hasPrev) {
+         MultiFab::LinComb(a_anderson.dF[a_anderson.head][lev], 1.0, fk[lev], 0,
+                           -1.0, a_anderson.fPrev[lev], 0, 0, 1, 0);
+         MultiFab::LinComb(a_anderson.dG[a_anderson.head][lev], 1.0, ldata_p->state, TEMP,
+                           -1.0, a_anderson.gPrev[lev], 0, 0, 1, 0);
+      }
+      MultiFab::Copy(a_anderson.fPrev[lev], fk[lev], 0, 0, 1, 0);
+      MultiFab::Copy(a_anderson.gPrev[lev], ldata_p->state, TEMP, 0, 1, 0);
+   }
+   if (!a_anderson.hasPrev) {
+      a_anderson.hasPrev = 1;
+      return;
+   }
+   a_anderson.head = (a_anderson.head + 1) % a_anderson.depth;
+   a_anderson.nHist = std::min(a_anderson.nHist + 1, a_anderson.depth);
+
+   // Normal equations (dF^T dF) gamma = dF^T f_k, dot products restricted
+   // to the cells not covered by a finer level, all in a single reduction
+   const int m = a_anderson.nHist;
+   auto slot = [&a_anderson,m](int j) {
+      return (a_anderson.head - m + j + a_anderson.depth) % a_anderson.depth;
+   };
+   auto levDot = [this](int lev, const MultiFab &a, const MultiFab &b) {
+      if (lev < finest_level) {
+         return MultiFab::Dot(*m_coveredMask[lev], a, 0, b, 0, 1, 0, true);
+      }
+      return MultiFab::Dot(a, 0, b, 0, 1, 0, true);
+   };
+   Vector<Real> dots(m*m+m,0.0);
+   for (int lev = 0; lev <= finest_level; ++lev) {
+      for (int i = 0; i < m; ++i) {
+         const MultiFab &dFi = a_anderson.dF[slot(i)][lev];
+         for (int j = 0; j <= i; ++j) {
+            dots[i*m+j] += levDot(lev, dFi, a_anderson.dF[slot(j)][lev]);
+         }
+         dots[m*m+i] += levDot(lev, dFi, fk[lev]);
+      }
+   }
+   ParallelDescriptor::ReduceRealSum(dots.data(), static_cast<int>(dots.size()));
+
+   // Small dense solve with Tikhonov regularization and partial pivoting
+   Vector<Vector<Real>> A(m, Vector<Real>(m+1,0.0));
+   Real trace = 0.0;
+   for (int i = 0; i < m; ++i) {
+      for (int j = 0; j <= i; ++j) {
+         A[i][j] = A[j][i] = dots[i*m+j];
+      }
+      A[i][m] = dots[m*m+i];
+      trace += A[i][i];
+   }
+   if (trace <= 0.0) return;
+   for (int i = 0; i < m; ++i) {
+      A[i][i] += 1.0e-12 * trace;
+   }
+   for (int c = 0; c < m; ++c) {
+      int piv = c;
+      for (int r = c+1; r < m; ++r) {
+         if (std::abs(A[r][c]) > std::abs(A[piv][c])) piv = r;
+      }
+      std::swap(A[c],A[piv]);
+      if (std::abs(A[c][c]) <= 1.0e-14 * trace) {
+         // Degenerate history: restart the acceleration from the current iterate
+         a_anderson.nHist = 0;
+         return;
+      }
+      for (int r = c+1; r < m; ++r) {
+         const Real fac = A[r][c] / A[c][c];
+         for (int k = c; k <= m; ++k) {
+            A[r][k] -= fac * A[c][k];
+         }
+      }
+   }
+   Vector<Real> gamma(m,0.0);
+   for (int i = m-1; i >= 0; --i) {
+      Real sum = A[i][m];
+      for (int k = i+1; k < m; ++k) {
+         sum -= A[i][k] * gamma[k];
+      }
+      gamma[i] = sum / A[i][i];
+   }
+
+   // Mix the new temperature
+   for (int lev = 0; lev <= finest_level; ++lev) {
+      auto ldata_p = getLevelDataPtr(lev,AmrNewTime);
+      for (int j = 0; j < m; ++j) {
+         MultiFab::Saxpy(ldata_p->state, -gamma[j], a_anderson.dG[slot(j)][lev], 0, TEMP, 1, 0);
+      }
+   }
+}
+
 void PeleLM::getScalarDiffForce(std::unique_ptr<AdvanceAdvData> &advData,
                                 std::unique_ptr<AdvanceDiffData> &diffData)
 {
@@ -1401,17 +1808,122 @@ void PeleLM::diffuseVelocity()
 
    // CrankNicholson 0.5 coeff
    const Real dt_lcl = 0.5 * m_dt;
-   if (m_incompressible) {
-      getDiffusionTensorOp()->diffuse_velocity(GetVecOfPtrs(getVelocityVect(AmrNewTime)),
-                                               {},
-                                               GetVecOfConstPtrs(getViscosityVect(AmrNewTime)),
-                                               bcRec[0], dt_lcl);
-   } else {
-      getDiffusionTensorOp()->diffuse_velocity(GetVecOfPtrs(getVelocityVect(AmrNewTime)),
-                                               GetVecOfConstPtrs(getDensityVect(AmrHalfTime)),
-                                               GetVecOfConstPtrs(getViscosityVect(AmrNewTime)),
+
+   auto velVect  = getVelocityVect(AmrNewTime);
+   auto viscVect = getViscosityVect(AmrNewTime);
+   Vector<std::unique_ptr<MultiFab> > rhoVect;
+   if (!m_incompressible) rhoVect = getDensityVect(AmrHalfTime);
+   Vector<MultiFab const*> rhoHalf = GetVecOfConstPtrs(rhoVect);
+
+   // Coarse levels with a low viscous CFL get an explicit update, the others the implicit solve
+   int nExplicit = (m_velDiffExplicitCFL > 0.0) ? getExplicitVelDiffLevels(rhoHalf) : 0;
+
+   // Reference full implicit solve to assess the explicit levels
+   Vector<MultiFab> velRef;
+   if (nExplicit > 0 && m_velDiffExplicitCheck) {
+      velRef.resize(finest_level+1);
+      for (int lev = 0; lev <= finest_level; ++lev) {
+         velRef[lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM, velVect[lev]->nGrow(), MFInfo(), Factory(lev));
+         MultiFab::Copy(velRef[lev], *velVect[lev], 0, 0, AMREX_SPACEDIM, velVect[lev]->nGrow());
+      }
+      getDiffusionTensorOp()->diffuse_velocity(GetVecOfPtrs(velRef), rhoHalf,
+                                               GetVecOfConstPtrs(viscVect),
                                                bcRec[0], dt_lcl);
    }
+
+   if (nExplicit > 0) {
+      // U^{np1*} = U^{np1**} + 0.5*dt/rho^{n+1/2} divTau(U^{np1**})
+      // The apply operator spans all the levels, only the explicit ones are updated
+      Vector<MultiFab> divTau(finest_level+1);
+      for (int lev = 0; lev <= finest_level; ++lev) {
+         divTau[lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM, 0, MFInfo(), Factory(lev));
+         divTau[lev].setVal(0.0);
+      }
+      getDiffusionTensorOp()->compute_divtau(GetVecOfPtrs(divTau),
+                                             GetVecOfConstPtrs(velVect),
+                                             rhoHalf,
+                                             GetVecOfConstPtrs(viscVect),
+                                             bcRec[0], 1.0);
+      const Real scale = (m_incompressible) ? dt_lcl / m_rho : dt_lcl;
+      for (int lev = 0; lev < nExplicit; ++lev) {
+         MultiFab::Saxpy(*velVect[lev], scale, divTau[lev], 0, 0, AMREX_SPACEDIM, 0);
+      }
+   }
+
+   if (nExplicit <= finest_level) {
+      getDiffusionTensorOp()->diffuse_velocity(GetVecOfPtrs(velVect), rhoHalf,
+                                               GetVecOfConstPtrs(viscVect),
+                                               bcRec[0], dt_lcl, nExplicit);
+   }
+
+   if (nExplicit > 0 && nExplicit <= finest_level) {
+      // Get the explicit levels covered data from the implicit ones
+      averageDownVelocity(AmrNewTime);
+   }
+
+   if (!velRef.empty()) {
+      for (int lev = 0; lev < nExplicit; ++lev) {
+         MultiFab::Subtract(velRef[lev], *velVect[lev], 0, 0, AMREX_SPACEDIM, 0);
+         Print() << "   Explicit velocity diffusion on level " << lev << ", max |U - U_implicit|: ";
+         for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            Print() << velRef[lev].norm0(idim) << " ";
+         }
+         Print() << "\n";
+      }
+   }
+}
+
+int PeleLM::getExplicitVelDiffLevels(const Vector<MultiFab const*> &a_rho)
+{
+   BL_PROFILE("PeleLM::getExplicitVelDiffLevels()");
+   // Velocity BCRec to get the viscosity on faces
+   auto bcRec = fetchBCRecArray(VELX,AMREX_SPACEDIM);
+
+   // Viscous CFL: dt * max(mu_eff) / min(rho) * \sum_d 1/dx_d^2, using the face viscosity
+   // including the turbulent contribution. The explicit levels need to be the coarsest ones
+   // since the implicit solve gets its coarse-fine BC from the level below.
+   int nExplicit = 0;
+   bool contiguous = true;
+   Vector<Real> viscCFL(finest_level+1,0.0);
+   for (int lev = 0; lev <= finest_level; ++lev) {
+      auto ldata_p = getLevelDataPtr(lev,AmrNewTime);
+      int doZeroVisc = 0;
+      int addTurbContrib = 1;
+      Array<MultiFab,AMREX_SPACEDIM> visc_ec = getDiffusivity(lev, 0, 1, doZeroVisc, bcRec, ldata_p->visc_cc, addTurbContrib);
+      Real muMax = 0.0;
+      for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+         auto const& vma = visc_ec[idim].const_arrays();
+         // Skip the EB covered faces dummy values
+         muMax = std::max(muMax, ParReduce(TypeList<ReduceOpMax>{}, TypeList<Real>{}, visc_ec[idim], IntVect(0),
+         [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept -> GpuTuple<Real>
+         {
+            const Real mu = vma[box_no](i,j,k);
+            return { (mu < 1.0e30) ? mu : 0.0 };
+         }));
+      }
+      ParallelDescriptor::ReduceRealMax(muMax);
+      const Real rhoMin = (a_rho.empty()) ? m_rho : a_rho[lev]->min(0);
+      const auto dxinv = geom[lev].InvCellSizeArray();
+      Real dxinv2 = 0.0;
+      for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+         dxinv2 += dxinv[idim]*dxinv[idim];
+      }
+      viscCFL[lev] = m_dt * muMax / rhoMin * dxinv2;
+      if (contiguous && viscCFL[lev] < m_velDiffExplicitCFL) {
+         nExplicit++;
+      } else {
+         contiguous = false;
+      }
+   }
+
+   if (m_verbose > 1) {
+      Print() << "   Velocity diffusion viscous CFL:";
+      for (int lev = 0; lev <= finest_level; ++lev) {
+         Print() << " " << viscCFL[lev] << ((lev < nExplicit) ? " (explicit)" : " (implicit)");
+      }
+      Print() << "\n";
+   }
+   return nExplicit;
 }
 
 Array<LinOpBCType,AMREX_SPACEDIM>
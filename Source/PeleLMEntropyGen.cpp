@@ -0,0 +1,112 @@
+#include <PeleLM.H>
+#include <PeleLMDeriveFunc.H>
+#ifdef AMREX_USE_EB
+#include <AMReX_EB_utils.H>
+#endif
+
+using namespace amrex;
+
+void PeleLM::initEntropyGenAverage(int lev,
+                                   const BoxArray& ba,
+                                   const DistributionMapping& dm)
+{
+   if (!m_do_entropyAvg) return;
+
+   m_entropyGenSum[lev].reset(new MultiFab(ba, dm, NUM_ENTROPYGEN, 0, MFInfo(), *m_factory[lev]));
+   m_entropyGenSum[lev]->setVal(0.0);
+}
+
+void PeleLM::updateEntropyGenAverage(const Real &a_dt)
+{
+   if (!m_do_entropyAvg) return;
+
+   BL_PROFILE("PeleLM::updateEntropyGenAverage()");
+
+   for (int lev = 0; lev <= finest_level; ++lev) {
+      // The entropy generation derive needs a single ghost cell for the gradients
+      std::unique_ptr<MultiFab> statemf = fillPatchState(lev, m_t_new[lev], 1);
+
+      MultiFab& sgenSum = *m_entropyGenSum[lev];
+      const Vector<BCRec> bcrec(NUM_ENTROPYGEN, m_bcrec_force[0]);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+      {
+         FArrayBox sgenfab;
+         for (MFIter mfi(sgenSum,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+         {
+            const Box& bx = mfi.tilebox();
+            sgenfab.resize(bx, NUM_ENTROPYGEN, The_Async_Arena());
+            const FArrayBox& statefab = (*statemf)[mfi];
+            pelelm_derentropygen(this, bx, sgenfab, 0, NUM_ENTROPYGEN,
+                                 statefab, statefab, statefab,
+                                 geom[lev], m_t_new[lev], bcrec, lev);
+            sgenSum[mfi].saxpy<RunOn::Device>(a_dt, sgenfab, bx, bx, 0, 0, NUM_ENTROPYGEN);
+         }
+      }
+   }
+
+   m_entropyAvgTime += a_dt;
+}
+
+void PeleLM::storeEntropyDiffFluxes(const Vector<Array<MultiFab*,AMREX_SPACEDIM> > &a_fluxes)
+{
+   BL_PROFILE("PeleLM::storeEntropyDiffFluxes()");
+
+   m_entropyDiffFluxes.resize(finest_level+1);
+   for (int lev = 0; lev <= finest_level; ++lev) {
+      for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+         auto& flux = m_entropyDiffFluxes[lev][idim];
+         const MultiFab& src = *a_fluxes[lev][idim];
+         if (!flux || flux->boxArray() != src.boxArray()
+                   || flux->DistributionMap() != src.DistributionMap()) {
+            flux = std::make_unique<MultiFab>(src.boxArray(), src.DistributionMap(),
+                                              NUM_SPECIES+1, 0, MFInfo(), Factory(lev));
+         }
+         MultiFab::Copy(*flux, src, 0, 0, NUM_SPECIES+1, 0);
+      }
+#ifdef AMREX_USE_EB
+      EB_set_covered_faces({AMREX_D_DECL(m_entropyDiffFluxes[lev][0].get(),
+                                         m_entropyDiffFluxes[lev][1].get(),
+                                         m_entropyDiffFluxes[lev][2].get())},0.0);
+#endif
+   }
+   m_entropyDiffFluxTime = m_t_new[0];
+}
+
+bool PeleLM::getEntropyDiffFluxes(int lev,
+                                  const Real &a_time,
+                                  const Box &a_bx,
+                                  GpuArray<Array4<const Real>,AMREX_SPACEDIM> &a_fluxes,
+                                  Array4<const Real> &a_visc) const
+{
+   if (!m_keepEntropyDiffFluxes
+       || a_time != m_entropyDiffFluxTime
+       || lev >= static_cast<int>(m_entropyDiffFluxes.size())
+       || !m_entropyDiffFluxes[lev][0]) {
+      return false;
+   }
+
+   // The fluxes must match the current level grids
+   const MultiFab& flux0 = *m_entropyDiffFluxes[lev][0];
+   if (flux0.DistributionMap() != dmap[lev]
+       || flux0.boxArray() != amrex::convert(grids[lev],IntVect::TheDimensionVector(0))) {
+      return false;
+   }
+
+   // Locate the level box containing a_bx, owned by this rank
+   const auto isects = grids[lev].intersections(a_bx, true, 0);
+   if (isects.empty() || !grids[lev][isects[0].first].contains(a_bx)) {
+      return false;
+   }
+   const int K = isects[0].first;
+   if (dmap[lev][K] != ParallelDescriptor::MyProc()) {
+      return false;
+   }
+
+   for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+      a_fluxes[idim] = m_entropyDiffFluxes[lev][idim]->const_array(K);
+   }
+   a_visc = m_leveldata_new[lev]->visc_cc.const_array(K);
+   return true;
+}
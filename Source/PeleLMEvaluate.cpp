@@ -6,6 +6,8 @@ using namespace amrex;
 void PeleLM::Evaluate() {
    BL_PROFILE("PeleLM::Evaluate()");
 
+   invalidateFillPatchCache();
+
    //----------------------------------------------------------------
    // Check that requested evaluate entries exist and determine the size
    // of the container and entries names
@@ -193,8 +195,7 @@ PeleLM::MLevaluate(const Vector<MultiFab *> &a_MFVec,
     } else if ( a_var == "transportCC" ) {
         // Cell-centered transport coefficients functions go through the level
         // data container. Simply copy once the later has been filled.
-        calcViscosity(AmrNewTime);
-        calcDiffusivity(AmrNewTime);
+        calcTransport(AmrNewTime);
         for (int lev = 0; lev <= finest_level; ++lev) {
            auto ldata_p = getLevelDataPtr(lev,AmrNewTime);
            MultiFab::Copy(*a_MFVec[lev],ldata_p->diff_cc,0,a_comp,NUM_SPECIES+1,0);
@@ -259,8 +260,7 @@ PeleLM::evaluateChemExtForces(const amrex::Vector<amrex::MultiFab*> &a_chemForce
    fillPatchState(AmrOldTime);
 
    // compute t^{n} data
-   calcViscosity(AmrOldTime);
-   calcDiffusivity(AmrOldTime);
+   calcTransport(AmrOldTime);
 
    floorSpecies(AmrOldTime);
    setThermoPress(AmrOldTime);
@@ -358,8 +358,7 @@ PeleLM::evaluateAdvectionTerms(const amrex::Vector<amrex::MultiFab*> &a_advTerms
    fillPatchState(AmrOldTime);
 
    // compute t^{n} data
-   calcViscosity(AmrOldTime);
-   calcDiffusivity(AmrOldTime);
+   calcTransport(AmrOldTime);
 
    floorSpecies(AmrOldTime);
    setThermoPress(AmrOldTime);
@@ -26,6 +26,7 @@ void PeleLM::Evolve() {
          // Average down I_R to have proper values in newly uncovered areas
          if (!m_incompressible) averageDownReaction();
          regrid(0, m_cur_time);
+         if (m_verbose > 1) reportDiffusionOpPool();
          resetMacProjector();
          resetCoveredMask();
          regridded = true;
@@ -60,6 +61,11 @@ void PeleLM::Evolve() {
       // Diagnostics
       doDiagnostics();
 
+      // Slice/subvolume output
+      if (writeSliceNow()) {
+         WriteSliceOutput();
+      }
+
       // Check message
       bool dump_and_stop = checkMessage("dump_and_stop");
       bool plt_and_continue = checkMessage("plt_and_continue");
@@ -99,6 +105,10 @@ void PeleLM::Evolve() {
    if (m_verbose > 0) {
       amrex::Print() << "\n >> Final simulation time: " << m_cur_time << "\n";
    }
+   if (m_verbose > 1) {
+      reportDiffusionOpPool();
+      reportFillPatchCache();
+   }
    if ( (m_plot_int > 0 ||
          m_plot_per_approx > 0. ||
          m_plot_per_exact > 0.) &&
@@ -112,6 +122,13 @@ void PeleLM::Evolve() {
          m_nstep > 0) {
       WriteCheckPointFile();
    }
+
+   // Flush the asynchronous output
+   asyncOutputWait();
+   if (m_verbose && m_asyncOut.count > 0) {
+      amrex::Print() << " Async output: " << m_asyncOut.count << " files, "
+                     << m_asyncOut.totalHidden << " s of write time hidden\n";
+   }
 }
 
 bool
@@ -52,6 +52,7 @@ void PeleLM::MakeNewLevelFromScratch( int lev,
 #endif
 
    // Initialize the LevelData
+   invalidateFaceCoeffCache(lev);
    m_leveldata_old[lev].reset(new LevelData(grids[lev], dmap[lev], *m_factory[lev],
                                             m_incompressible, m_has_divu,
                                             m_nAux, m_nGrowState, m_use_soret, m_do_les));
@@ -68,6 +69,8 @@ void PeleLM::MakeNewLevelFromScratch( int lev,
       m_leveldatareact[lev]->functC.setVal(0.0);
    }
 
+   initEntropyGenAverage(lev, grids[lev], dmap[lev]);
+
 #ifdef PELE_USE_EFIELD
    m_leveldatanlsolve[lev].reset(new LevelDataNLSolve(grids[lev], dmap[lev], *m_factory[lev], m_nGrowState));
    if (m_do_extraEFdiags) {
@@ -87,6 +90,7 @@ void PeleLM::MakeNewLevelFromScratch( int lev,
    // Times
    m_t_new[lev] = time;
    m_t_old[lev] = time - 1.0e200;
+   invalidateFillPatchCache();
 
    // Load balance
    m_costs[lev] = std::make_unique<LayoutData<Real>>(ba, dm);
@@ -431,6 +435,7 @@ void PeleLM::projectInitSolution()
          ldata_p->gp.setVal(0.0);
       }
    }
+   invalidateFillPatchCache();
 }
 
 void PeleLM::initialIterations() {
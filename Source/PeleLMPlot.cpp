@@ -6,6 +6,7 @@
 #include <AMReX_ParmParse.H>
 #include <PeleLMBCfill.H>
 #include <AMReX_FillPatchUtil.H>
+#include <AMReX_AsyncOut.H>
 #ifdef AMREX_USE_EB
 #include <AMReX_EBInterpolater.H>
 #endif
@@ -56,6 +57,10 @@ void PeleLM::WritePlotFile() {
       amrex::Print() << "\n Writing plotfile: " << plotfilename << "\n";
    }
 
+   // Wait for the previous asynchronous output to complete
+   asyncOutputWait();
+   const Real writeStart = ParallelDescriptor::second();
+
    //----------------------------------------------------------------
    // Average down the state
    averageDownState(AmrNewTime);
@@ -109,6 +114,11 @@ void PeleLM::WritePlotFile() {
       deriveEntryCount += rec->numDerive();
    }
    ncomp += deriveEntryCount;
+
+   // Time-averaged entropy generation
+   if (m_do_entropyAvg) {
+      ncomp += NUM_ENTROPYGEN;
+   }
 #ifdef PELELM_USE_SPRAY
    if (do_spray_particles) {
      ncomp += SprayParticleContainer::NumDeriveVars();
@@ -197,6 +207,13 @@ void PeleLM::WritePlotFile() {
          plt_VarsName.push_back(rec->variableName(dvar));
       }
    }
+
+   if (m_do_entropyAvg) {
+      plt_VarsName.push_back("avg_entropy_gen_heat");
+      plt_VarsName.push_back("avg_entropy_gen_visc");
+      plt_VarsName.push_back("avg_entropy_gen_diff");
+      plt_VarsName.push_back("avg_entropy_gen_chem");
+   }
 #ifdef PELELM_USE_SPRAY
    if (SprayParticleContainer::NumDeriveVars() > 0) {
      // We need virtual particles for the lower levels
@@ -296,6 +313,13 @@ void PeleLM::WritePlotFile() {
          MultiFab::Copy(mf_plt[lev], *mf, 0, cnt, mf->nComp(), 0);
          cnt += mf->nComp();
       }
+
+      if (m_do_entropyAvg) {
+         MultiFab::Copy(mf_plt[lev], *m_entropyGenSum[lev], 0, cnt, NUM_ENTROPYGEN, 0);
+         Real avgFactor = (m_entropyAvgTime > 0.0) ? 1.0 / m_entropyAvgTime : 0.0;
+         mf_plt[lev].mult(avgFactor, cnt, NUM_ENTROPYGEN, 0);
+         cnt += NUM_ENTROPYGEN;
+      }
 #ifdef PELELM_USE_SPRAY
       if (SprayParticleContainer::NumDeriveVars() > 0) {
         const int num_spray_derive = SprayParticleContainer::NumDeriveVars();
@@ -354,18 +378,28 @@ void PeleLM::WritePlotFile() {
    }
 
 
+   // Error-bounded quantization and/or single precision rounding
+   if (m_plot_float32 || !m_plotQuantize.empty()) {
+      reducePlotPrecision(mf_plt, plt_VarsName);
+   }
+
    // No SubCycling, all levels the same step.
    Vector<int> istep(finest_level + 1, m_nstep);
 
 #ifdef AMREX_USE_HDF5
    if (m_write_hdf5_pltfile) {
        amrex::WriteMultiLevelPlotfileHDF5(plotfilename, finest_level + 1, GetVecOfConstPtrs(mf_plt),
-                                          plt_VarsName, Geom(), m_cur_time, istep, refRatio());
+                                          plt_VarsName, Geom(), m_cur_time, istep, refRatio(),
+                                          m_plot_compression);
    } else
 #endif
    {
+       // Single precision FABs, converted back by VisMF::Read
+       const FABio::Format fabFormat = FArrayBox::getFormat();
+       if (m_plot_float32) FArrayBox::setFormat(FABio::FAB_NATIVE_32);
        amrex::WriteMultiLevelPlotfile(plotfilename, finest_level + 1, GetVecOfConstPtrs(mf_plt),
                                       plt_VarsName, Geom(), m_cur_time, istep, refRatio());
+       FArrayBox::setFormat(fabFormat);
    }
 
 #ifdef PELELM_USE_SPRAY
@@ -378,6 +412,41 @@ void PeleLM::WritePlotFile() {
      }
    }
 #endif
+
+   asyncOutputSubmitted(plotfilename, writeStart);
+}
+
+void PeleLM::reducePlotPrecision(Vector<MultiFab> &a_mf,
+                                 const Vector<std::string> &a_varNames)
+{
+   BL_PROFILE("PeleLM::reducePlotPrecision()");
+
+   // Per-variable absolute tolerance: rounding to the nearest multiple of 2*tol
+   // bounds the error by tol and leaves long runs of identical bits for the compressors
+   const int ncomp = a_varNames.size();
+   Vector<Real> tol(ncomp,0.0);
+   parseVars(a_varNames, m_plotQuantize, tol);
+   Gpu::DeviceVector<Real> tol_d(ncomp);
+   Gpu::copy(Gpu::hostToDevice, tol.begin(), tol.end(), tol_d.begin());
+   const Real* tolp = tol_d.data();
+   const int toFloat = m_plot_float32;
+
+   for (int lev = 0; lev <= finest_level; ++lev) {
+      auto const& ma = a_mf[lev].arrays();
+      amrex::ParallelFor(a_mf[lev], IntVect(0), ncomp,
+      [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k, int n) noexcept
+      {
+         Real val = ma[box_no](i,j,k,n);
+         if (tolp[n] > 0.0) {
+            val = 2.0 * tolp[n] * std::round(val / (2.0 * tolp[n]));
+         }
+         if (toFloat) {
+            val = static_cast<Real>(static_cast<float>(val));
+         }
+         ma[box_no](i,j,k,n) = val;
+      });
+   }
+   Gpu::streamSynchronize();
 }
 
 void PeleLM::WriteHeader(const std::string& name, bool is_checkpoint) const
@@ -438,6 +507,9 @@ void PeleLM::WriteHeader(const std::string& name, bool is_checkpoint) const
         for (int n = 0; n < typical_values.size(); n++) {
             HeaderFile << typical_values[n] << "\n";
         }
+        if (is_checkpoint && m_do_entropyAvg) {
+            HeaderFile << m_entropyAvgTime << "\n";
+        }
     }
 }
 
@@ -451,6 +523,10 @@ void PeleLM::WriteCheckPointFile()
       amrex::Print() << "\n Writting checkpoint file: " << checkpointname << "\n";
    }
 
+   // Wait for the previous asynchronous output to complete
+   asyncOutputWait();
+   const Real writeStart = ParallelDescriptor::second();
+
    amrex::PreBuildDirectorHierarchy(checkpointname, level_prefix, finest_level + 1, true);
 
    bool is_checkpoint = true;
@@ -459,24 +535,29 @@ void PeleLM::WriteCheckPointFile()
 
    for(int lev = 0; lev <= finest_level; ++lev)
    {
-      VisMF::Write(m_leveldata_new[lev]->state,
-                   amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "state"));
+      writeCheckPointMF(m_leveldata_new[lev]->state,
+                    amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "state"));
 
-      VisMF::Write(m_leveldata_new[lev]->gp,
-                   amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "gradp"));
+      writeCheckPointMF(m_leveldata_new[lev]->gp,
+                    amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "gradp"));
 
-      VisMF::Write(m_leveldata_new[lev]->press,
-                   amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "p"));
+      writeCheckPointMF(m_leveldata_new[lev]->press,
+                    amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "p"));
 
       if (!m_incompressible) {
          if (m_has_divu) {
-            VisMF::Write(m_leveldata_new[lev]->divu,
-                         amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "divU"));
+            writeCheckPointMF(m_leveldata_new[lev]->divu,
+                          amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "divU"));
          }
 
          if (m_do_react) {
-            VisMF::Write(m_leveldatareact[lev]->I_R,
-                         amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "I_R"));
+            writeCheckPointMF(m_leveldatareact[lev]->I_R,
+                          amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "I_R"));
+         }
+
+         if (m_do_entropyAvg) {
+            writeCheckPointMF(*m_entropyGenSum[lev],
+                          amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "entropyGenSum"));
          }
       }
    }
@@ -488,6 +569,59 @@ void PeleLM::WriteCheckPointFile()
      }
    }
 #endif
+
+   asyncOutputSubmitted(checkpointname, writeStart);
+}
+
+void PeleLM::writeCheckPointMF(const MultiFab &a_mf, const std::string &a_name)
+{
+   if (AsyncOut::UseAsyncOut()) {
+      // The data are copied into host buffers before returning
+      VisMF::AsyncWrite(a_mf, a_name);
+   } else {
+      VisMF::Write(a_mf, a_name);
+   }
+}
+
+void PeleLM::asyncOutputSubmitted(const std::string &a_name, Real a_writeStart)
+{
+   if (!AsyncOut::UseAsyncOut()) return;
+
+   // The background thread processes its tasks in order: this marker
+   // completes once all the data of this output are on disk
+   auto marker = std::make_shared<std::promise<void>>();
+   auto doneTime = std::make_shared<Real>(0.0);
+   m_asyncOut.pending = marker->get_future();
+   m_asyncOut.doneTime = doneTime;
+   AsyncOut::Submit([marker, doneTime]() {
+      *doneTime = ParallelDescriptor::second();
+      marker->set_value();
+   });
+   m_asyncOut.name = a_name;
+   m_asyncOut.returnTime = ParallelDescriptor::second();
+   m_asyncOut.blockTime = m_asyncOut.returnTime - a_writeStart;
+   m_asyncOut.count++;
+}
+
+void PeleLM::asyncOutputWait(int a_report)
+{
+   if (!m_asyncOut.pending.valid()) return;
+
+   Real waitStart = ParallelDescriptor::second();
+   m_asyncOut.pending.get();
+   Real waitTime = ParallelDescriptor::second() - waitStart;
+
+   // Write time overlapped with the time loop
+   Real hidden = std::max(0.0, std::min(*m_asyncOut.doneTime, waitStart) - m_asyncOut.returnTime);
+   Real blockTime = m_asyncOut.blockTime;
+   ParallelDescriptor::ReduceRealMax(hidden, ParallelDescriptor::IOProcessorNumber());
+   ParallelDescriptor::ReduceRealMax(waitTime, ParallelDescriptor::IOProcessorNumber());
+   ParallelDescriptor::ReduceRealMax(blockTime, ParallelDescriptor::IOProcessorNumber());
+   m_asyncOut.totalHidden += hidden;
+   if (m_verbose && a_report) {
+      Print() << " Async output " << m_asyncOut.name << ": " << blockTime << " s blocking, "
+              << hidden << " s hidden, " << waitTime << " s waiting on completion\n";
+   }
 }
 
 void PeleLM::ReadCheckPointFile()
@@ -617,6 +751,13 @@ void PeleLM::ReadCheckPointFile()
        GotoNextLine(is);
    }
 
+   // Entropy generation averaging time, if the checkpoint has one
+   if (m_do_entropyAvg) {
+      if (!(is >> m_entropyAvgTime)) {
+         m_entropyAvgTime = 0.0;
+      }
+   }
+
    /***************************************************************************
     * Load fluid data                                                         *
     ***************************************************************************/
@@ -675,8 +816,20 @@ void PeleLM::ReadCheckPointFile()
                         amrex::MultiFabFileFullPrefix(lev, m_restart_chkfile, level_prefix, "I_R"));
          }
 #endif
+
+         // Entropy generation running sum: restart the average if missing from the checkpoint
+         if (m_do_entropyAvg) {
+            const std::string sgenFile = amrex::MultiFabFileFullPrefix(lev, m_restart_chkfile, level_prefix, "entropyGenSum");
+            if (m_entropyAvgTime > 0.0 && VisMF::Exist(sgenFile)) {
+               VisMF::Read(*m_entropyGenSum[lev], sgenFile);
+            } else {
+               m_entropyGenSum[lev]->setVal(0.0);
+               m_entropyAvgTime = 0.0;
+            }
+         }
       }
    }
+   invalidateFillPatchCache();
    if (m_verbose) {
       amrex::Print() << "Restart complete" << std::endl;
    }
@@ -310,7 +310,10 @@ void PeleLM::velocityProjection(int is_initIter,
       }
    }
 
-   doNodalProject(GetVecOfPtrs(vel), GetVecOfPtrs(sigma), GetVecOfPtrs(rhs_cc), {}, incremental, a_dt);
+   // The regular (non-incremental) variable density projection can reuse the persistent projector
+   int reuseProjector = (m_nodal_reuse_projector && !incremental && !m_incompressible) ? 1 : 0;
+   doNodalProject(GetVecOfPtrs(vel), GetVecOfPtrs(sigma), GetVecOfPtrs(rhs_cc), {}, incremental, a_dt,
+                  reuseProjector);
 
    // If incremental
    // define back to be U^{np1} by adding U^{n}
@@ -343,7 +346,8 @@ void PeleLM::doNodalProject(const Vector<MultiFab*> &a_vel,
                             const Vector<MultiFab*> &rhs_cc,
                             const Vector<const MultiFab*> &rhs_nd,
                             int incremental,
-                            Real scaling_factor) {
+                            Real scaling_factor,
+                            int a_reuseProjector) {
    int has_rhs = 0;
    int has_rhs_nd = 0;
    if (!rhs_cc.empty()) has_rhs = 1;
@@ -382,10 +386,33 @@ void PeleLM::doNodalProject(const Vector<MultiFab*> &a_vel,
       }
    }
 
+   // Persistent projector: update sigma and RHS in place, phi holds the previous
+   // solution and is used as initial guess
+   if (a_reuseProjector) {
+      if (!m_nodal_projector) {
+         setupPersistentNodalProjector(lobc, hibc);
+      }
+      for (int lev = 0; lev <= finest_level; ++lev) {
+         AMREX_ASSERT(a_vel[lev]->boxArray() == m_nodalProjVel[lev]->boxArray());
+         MultiFab::Copy(*m_nodalProjSigma[lev],*a_sigma[lev],0,0,1,0);
+         m_nodal_projector->getLinOp().setSigma(lev, *m_nodalProjSigma[lev]);
+         if (has_rhs) {
+            MultiFab::Copy(*m_nodalProjRhs[lev],*rhs_cc[lev],0,0,1,m_nodalProjRhs[lev]->nGrow());
+         } else {
+            m_nodalProjRhs[lev]->setVal(0.0);
+         }
+      }
+
+      // Solve
+      m_nodal_projector->project(GetVecOfPtrs(m_nodalProjPhi), m_nodal_mg_rtol, m_nodal_mg_atol);
+   }
+
    // Setup NodalProjector
    std::unique_ptr<Hydro::NodalProjector> nodal_projector;
 
-   if ( m_incompressible ) {
+   if ( a_reuseProjector ) {
+      // Nothing to do, solve already done
+   } else if ( m_incompressible ) {
       Real constant_sigma = scaling_factor / m_rho;
       nodal_projector.reset(new Hydro::NodalProjector(a_vel, constant_sigma, Geom(0,finest_level), info));
    } else {
@@ -397,17 +424,20 @@ void PeleLM::doNodalProject(const Vector<MultiFab*> &a_vel,
       }
    }
 
-   nodal_projector->setDomainBC(lobc, hibc);
+   if (!a_reuseProjector) {
+      nodal_projector->setDomainBC(lobc, hibc);
 
 #ifdef AMREX_USE_HYPRE
-   nodal_projector->getMLMG().setHypreOptionsNamespace(m_hypre_namespace_nodal);
+      nodal_projector->getMLMG().setHypreOptionsNamespace(m_hypre_namespace_nodal);
 #endif
 
-   // Solve
-   nodal_projector->project(m_nodal_mg_rtol, m_nodal_mg_atol);
+      // Solve
+      nodal_projector->project(m_nodal_mg_rtol, m_nodal_mg_atol);
+   }
 
-   auto phi = nodal_projector->getPhi();
-   auto gphi = nodal_projector->getGradPhi();
+   Hydro::NodalProjector* proj_p = (a_reuseProjector) ? m_nodal_projector.get() : nodal_projector.get();
+   auto phi = proj_p->getPhi();
+   auto gphi = proj_p->getGradPhi();
 
    for(int lev = 0; lev <= finest_level; lev++) {
 
@@ -465,6 +495,42 @@ void PeleLM::doNodalProject(const Vector<MultiFab*> &a_vel,
 
 }
 
+void PeleLM::setupPersistentNodalProjector(const std::array<LinOpBCType,AMREX_SPACEDIM> &a_lobc,
+                                           const std::array<LinOpBCType,AMREX_SPACEDIM> &a_hibc)
+{
+   BL_PROFILE("PeleLM::setupPersistentNodalProjector()");
+
+   m_nodalProjVel.resize(finest_level+1);
+   m_nodalProjSigma.resize(finest_level+1);
+   m_nodalProjRhs.resize(finest_level+1);
+   m_nodalProjPhi.resize(finest_level+1);
+   for (int lev = 0; lev <= finest_level; ++lev) {
+      // Velocity aliases the new state: valid until the next regrid
+      m_nodalProjVel[lev].reset(new MultiFab(m_leveldata_new[lev]->state,amrex::make_alias,VELX,AMREX_SPACEDIM));
+      m_nodalProjSigma[lev].reset(new MultiFab(grids[lev], dmap[lev], 1, 0, MFInfo(), *m_factory[lev]));
+      m_nodalProjSigma[lev]->setVal(1.0);
+      m_nodalProjRhs[lev].reset(new MultiFab(grids[lev], dmap[lev], 1, m_leveldata_new[lev]->divu.nGrow(),
+                                             MFInfo(), *m_factory[lev]));
+      m_nodalProjRhs[lev]->setVal(0.0);
+      const BoxArray& nba = amrex::convert(grids[lev],IntVect::TheNodeVector());
+      m_nodalProjPhi[lev].reset(new MultiFab(nba, dmap[lev], 1, 1, MFInfo(), *m_factory[lev]));
+      m_nodalProjPhi[lev]->setVal(0.0);
+   }
+
+   LPInfo info;
+   info.setMaxCoarseningLevel(m_nodal_mg_max_coarsening_level);
+
+   m_nodal_projector.reset(new Hydro::NodalProjector(GetVecOfPtrs(m_nodalProjVel),
+                                                     GetVecOfConstPtrs(m_nodalProjSigma),
+                                                     Geom(0,finest_level), info,
+                                                     GetVecOfPtrs(m_nodalProjRhs)));
+   m_nodal_projector->setDomainBC(a_lobc, a_hibc);
+
+#ifdef AMREX_USE_HYPRE
+   m_nodal_projector->getMLMG().setHypreOptionsNamespace(m_hypre_namespace_nodal);
+#endif
+}
+
 void
 PeleLM::scaleProj_RZ(int a_lev,
                     MultiFab &a_mf)
@@ -316,6 +316,12 @@ void PeleLM::MakeNewLevelFromCoarse( int lev,
       m_leveldatareact[lev] = std::move(n_leveldatareact);
    }
 
+   if (m_do_entropyAvg) {
+      std::unique_ptr<MultiFab> n_entropyGenSum( new MultiFab(ba, dm, NUM_ENTROPYGEN, 0, MFInfo(), *m_factory[lev]));
+      fillcoarsepatch_entropyGen(lev, time, *n_entropyGenSum, 0);
+      m_entropyGenSum[lev] = std::move(n_entropyGenSum);
+   }
+
    if (!m_incompressible) {
       // Enforce density / species density consistency
       // only usefull when using cell cons interp
@@ -334,6 +340,9 @@ void PeleLM::MakeNewLevelFromCoarse( int lev,
       m_coveredMask[lev].reset(new iMultiFab(ba, dm, 1, 0));
    }
    m_resetCoveredMask = 1;
+   m_chemBAData[lev].reset();
+   invalidateFaceCoeffCache(lev);
+   invalidateFillPatchCache();
 
 #ifdef PELE_USE_EFIELD
    m_leveldatanlsolve[lev].reset(new LevelDataNLSolve(ba, dm, *m_factory[lev], m_nGrowState));
@@ -347,12 +356,11 @@ void PeleLM::MakeNewLevelFromCoarse( int lev,
    m_costs[lev] = std::make_unique<LayoutData<Real>>(ba, dm);
 
    // DiffusionOp will be recreated
-   m_diffusion_op.reset();
-   m_mcdiffusion_op.reset();
-   m_diffusionTensor_op.reset();
+   resetDiffusionOps();
 
    // Trigger MacProj reset
    m_macProjNeedReset = 1;
+   m_nodal_projector.reset();
    m_extSource[lev].reset(new MultiFab(ba, dm, NVAR, amrex::max(m_nGrowAdv, m_nGrowMAC),
                                        MFInfo(), *m_factory[lev]));
    m_extSource[lev]->setVal(0.);
@@ -418,10 +426,19 @@ void PeleLM::RemakeLevel( int lev,
       m_leveldatareact[lev] = std::move(n_leveldatareact);
    }
 
+   if (m_do_entropyAvg) {
+      std::unique_ptr<MultiFab> n_entropyGenSum( new MultiFab(ba, dm, NUM_ENTROPYGEN, 0, MFInfo(), *m_factory[lev]));
+      fillpatch_entropyGen(lev, time, *n_entropyGenSum, 0);
+      m_entropyGenSum[lev] = std::move(n_entropyGenSum);
+   }
+
    if (max_level > 0 && lev != max_level) {
       m_coveredMask[lev].reset(new iMultiFab(ba, dm, 1, 0));
    }
    m_resetCoveredMask = 1;
+   m_chemBAData[lev].reset();
+   invalidateFaceCoeffCache(lev);
+   invalidateFillPatchCache();
 
    if (!m_incompressible) {
       // Enforce density / species density consistency
@@ -449,12 +466,11 @@ void PeleLM::RemakeLevel( int lev,
    m_costs[lev] = std::make_unique<LayoutData<Real>>(ba, dm);
 
    // DiffusionOp will be recreated
-   m_diffusion_op.reset();
-   m_mcdiffusion_op.reset();
-   m_diffusionTensor_op.reset();
+   resetDiffusionOps();
 
    // Trigger MacProj reset
    m_macProjNeedReset = 1;
+   m_nodal_projector.reset();
    m_extSource[lev].reset(new MultiFab(ba, dm, NVAR, amrex::max(m_nGrowAdv, m_nGrowMAC),
                                        MFInfo(), *m_factory[lev]));
    m_extSource[lev]->setVal(0.);
@@ -466,14 +482,17 @@ void PeleLM::ClearLevel(int lev) {
    m_leveldata_old[lev].reset();
    m_leveldata_new[lev].reset();
    if (m_do_react) m_leveldatareact[lev].reset();
+   if (m_do_entropyAvg) m_entropyGenSum[lev].reset();
    if (max_level > 0 && lev != max_level) m_coveredMask[lev].reset();
    m_baChem[lev].reset();
    m_dmapChem[lev].reset();
+   m_chemBAData[lev].reset();
+   invalidateFaceCoeffCache(lev);
+   invalidateFillPatchCache();
    m_factory[lev].reset();
-   m_diffusion_op.reset();
-   m_mcdiffusion_op.reset();
-   m_diffusionTensor_op.reset();
+   resetDiffusionOps();
    macproj.reset();
+   m_nodal_projector.reset();
 #ifdef PELE_USE_EFIELD
    m_leveldatanlsolve[lev].reset();
    if (m_do_extraEFdiags) {
@@ -0,0 +1,165 @@
+#include <PeleLM.H>
+#include <algorithm>
+
+using namespace amrex;
+
+void PeleLM::readSampleDumpParameters()
+{
+   ParmParse pp("peleLM.sampleDump");
+
+   int nVars = pp.countval("vars");
+   if (nVars == 0) return;
+   m_sampleDumpVars.resize(nVars);
+   pp.getarr("vars",m_sampleDumpVars,0,nVars);
+
+   pp.query("stride",m_sampleDumpStride);
+   pp.query("file",m_sampleDumpFile);
+   int nProbeCoords = pp.countval("probe_locs");
+   if (nProbeCoords > 0) {
+      if (nProbeCoords % AMREX_SPACEDIM != 0) {
+         amrex::Abort("peleLM.sampleDump.probe_locs must contain AMREX_SPACEDIM coordinates per probe");
+      }
+      m_sampleDumpProbes.resize(nProbeCoords);
+      pp.getarr("probe_locs",m_sampleDumpProbes,0,nProbeCoords);
+      // Probes replace the strided sampling unless a stride is explicitly given
+      if (!pp.contains("stride")) m_sampleDumpStride = 0;
+   }
+   if (m_sampleDumpStride < 0) {
+      amrex::Abort("peleLM.sampleDump.stride must be >= 0");
+   }
+}
+
+bool PeleLM::isSampleDumpVar(const std::string &a_name) const
+{
+   return std::find(m_sampleDumpVars.begin(), m_sampleDumpVars.end(), a_name) != m_sampleDumpVars.end();
+}
+
+void PeleLM::sampleDump(const std::string &a_name,
+                        int lev,
+                        Real a_time,
+                        const MultiFab &a_derive,
+                        const MultiFab &a_state)
+{
+   BL_PROFILE("PeleLM::sampleDump()");
+
+   // Sampled data: cell center, density, temperature and the derived components
+   const int nDer = a_derive.nComp();
+   const int nComp = AMREX_SPACEDIM + 2 + nDer;
+   const int stride = m_sampleDumpStride;
+   const int nProbes = static_cast<int>(m_sampleDumpProbes.size()) / AMREX_SPACEDIM;
+
+   const auto prob_lo = geom[lev].ProbLoArray();
+   const auto dx      = geom[lev].CellSizeArray();
+   const auto dxinv   = geom[lev].InvCellSizeArray();
+
+   // Count the local samples and set each box offset in the per-rank buffer
+   Vector<Box> strideBoxes(a_derive.local_size());
+   Vector<Vector<IntVect>> probeCells(a_derive.local_size());
+   Vector<Long> boxOffset(a_derive.local_size()+1,0);
+   for (MFIter mfi(a_derive); mfi.isValid(); ++mfi) {
+      const Box& bx = mfi.validbox();
+      const int li = mfi.LocalIndex();
+      Long nLoc = 0;
+      if (stride > 0) {
+         // Cells whose global index is a multiple of the stride in every direction
+         IntVect clo, chi;
+         for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            clo[idim] = (bx.smallEnd(idim) + stride - 1) / stride;
+            chi[idim] = bx.bigEnd(idim) / stride;
+         }
+         strideBoxes[li] = Box(clo,chi);
+         if (strideBoxes[li].ok()) nLoc += strideBoxes[li].numPts();
+      }
+      for (int p = 0; p < nProbes; ++p) {
+         IntVect iv(AMREX_D_DECL(static_cast<int>(std::floor((m_sampleDumpProbes[p*AMREX_SPACEDIM+0]-prob_lo[0])*dxinv[0])),
+                                 static_cast<int>(std::floor((m_sampleDumpProbes[p*AMREX_SPACEDIM+1]-prob_lo[1])*dxinv[1])),
+                                 static_cast<int>(std::floor((m_sampleDumpProbes[p*AMREX_SPACEDIM+2]-prob_lo[2])*dxinv[2]))));
+         if (bx.contains(iv)) probeCells[li].push_back(iv);
+      }
+      nLoc += probeCells[li].size();
+      boxOffset[li+1] = nLoc;
+   }
+   for (int li = 0; li < a_derive.local_size(); ++li) {
+      boxOffset[li+1] += boxOffset[li];
+   }
+   const Long nLocal = boxOffset[a_derive.local_size()];
+
+   // Gather the sampled values in the per-rank buffer
+   Gpu::DeviceVector<Real> sampleBuf(nLocal*nComp);
+   Real* buf = sampleBuf.data();
+   for (MFIter mfi(a_derive); mfi.isValid(); ++mfi) {
+      const int li = mfi.LocalIndex();
+      auto const& der   = a_derive.const_array(mfi);
+      auto const& state = a_state.const_array(mfi);
+      auto gather = [=] AMREX_GPU_DEVICE (Long idx, int i, int j, int k) noexcept
+      {
+         Real* s = buf + idx*nComp;
+         AMREX_D_TERM(s[0] = prob_lo[0] + (i+0.5)*dx[0];,
+                      s[1] = prob_lo[1] + (j+0.5)*dx[1];,
+                      s[2] = prob_lo[2] + (k+0.5)*dx[2];)
+         s[AMREX_SPACEDIM]   = state(i,j,k,DENSITY);
+         s[AMREX_SPACEDIM+1] = state(i,j,k,TEMP);
+         for (int n = 0; n < nDer; ++n) {
+            s[AMREX_SPACEDIM+2+n] = der(i,j,k,n);
+         }
+      };
+
+      const Long offset = boxOffset[li];
+      const Box& sbx = strideBoxes[li];
+      if (stride > 0 && sbx.ok()) {
+         const auto slo = amrex::lbound(sbx);
+         const auto slen = amrex::length(sbx);
+         amrex::ParallelFor(sbx, [=] AMREX_GPU_DEVICE (int ic, int jc, int kc) noexcept
+         {
+            const Long idx = offset + (ic-slo.x) + static_cast<Long>(slen.x)*((jc-slo.y) + static_cast<Long>(slen.y)*(kc-slo.z));
+            gather(idx, ic*stride, jc*stride, kc*stride);
+         });
+      }
+      const int nProbeBox = probeCells[li].size();
+      if (nProbeBox > 0) {
+         const Long probeOffset = boxOffset[li+1] - nProbeBox;
+         Gpu::DeviceVector<IntVect> d_probes(nProbeBox);
+         Gpu::copy(Gpu::hostToDevice, probeCells[li].begin(), probeCells[li].end(), d_probes.begin());
+         const IntVect* probes = d_probes.data();
+         amrex::ParallelFor(nProbeBox, [=] AMREX_GPU_DEVICE (int p) noexcept
+         {
+            const Dim3 cell = probes[p].dim3();
+            gather(probeOffset+p, cell.x, cell.y, cell.z);
+         });
+         Gpu::streamSynchronize();
+      }
+   }
+   Gpu::streamSynchronize();
+
+   Vector<Real> hostBuf(nLocal*nComp);
+   Gpu::copy(Gpu::deviceToHost, sampleBuf.begin(), sampleBuf.end(), hostBuf.begin());
+
+   // Single gather on the IO processor and binary write
+   const int ioProc = ParallelDescriptor::IOProcessorNumber();
+   const int nProcs = ParallelDescriptor::NProcs();
+   int sendCount = static_cast<int>(nLocal*nComp);
+   std::vector<int> recvCounts(nProcs,0);
+   ParallelDescriptor::Gather(&sendCount, 1, recvCounts.data(), 1, ioProc);
+   std::vector<int> disp(nProcs,0);
+   for (int p = 1; p < nProcs; ++p) {
+      disp[p] = disp[p-1] + recvCounts[p-1];
+   }
+   Vector<Real> allSamples(ParallelDescriptor::IOProcessor() ? disp[nProcs-1] + recvCounts[nProcs-1] : 0);
+   ParallelDescriptor::Gatherv(hostBuf.data(), sendCount, allSamples.data(), recvCounts, disp, ioProc);
+
+   if (ParallelDescriptor::IOProcessor()) {
+      // Binary record: step, time, level, nComp, nSamples, then nSamples x nComp values
+      const std::string fileName = m_sampleDumpFile + "_" + a_name;
+      std::ofstream dumpFile(fileName.c_str(), std::ios::out | std::ios::app | std::ios_base::binary);
+      if (!dumpFile.good()) {
+         amrex::FileOpenFailed(fileName);
+      }
+      const int nSamples = static_cast<int>(allSamples.size()) / nComp;
+      dumpFile.write(reinterpret_cast<const char*>(&m_nstep), sizeof(int));
+      dumpFile.write(reinterpret_cast<const char*>(&a_time), sizeof(Real));
+      dumpFile.write(reinterpret_cast<const char*>(&lev), sizeof(int));
+      dumpFile.write(reinterpret_cast<const char*>(&nComp), sizeof(int));
+      dumpFile.write(reinterpret_cast<const char*>(&nSamples), sizeof(int));
+      dumpFile.write(reinterpret_cast<const char*>(allSamples.data()), allSamples.size()*sizeof(Real));
+   }
+}
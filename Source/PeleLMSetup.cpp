@@ -3,6 +3,7 @@
 #include <PeleLMDeriveFunc.H>
 #include "PelePhysics.H"
 #include <AMReX_buildInfo.H>
+#include <AMReX_AsyncOut.H>
 #ifdef PELE_USE_EFIELD
 #include "EOS_Extension.H"
 #endif
@@ -17,9 +18,7 @@
 using namespace amrex;
 
 static Box the_same_box (const Box& b)    { return b;                }
-#ifdef PELE_USE_EFIELD
 static Box grow_box_by_one (const Box& b) { return amrex::grow(b,1); }
-#endif
 static Box grow_box_by_two (const Box& b) { return amrex::grow(b,2); }
 
 void PeleLM::Setup() {
@@ -78,6 +77,9 @@ void PeleLM::Setup() {
    // Diagnostics setup
    createDiagnostics();
 
+   // Slice/subvolume output setup
+   createSliceOutput();
+
    // Initialize Level Hierarchy data
    resizeArray();
 
@@ -85,6 +87,9 @@ void PeleLM::Setup() {
    if (!m_incompressible) {
       amrex::Print() << " Initialization of Transport ... \n";
       trans_parms.allocate();
+      if (m_use_transTable) {
+         buildTransportTable();
+      }
       if (m_les_verbose and m_do_les)
         amrex::Print() << "    Using LES in transport with Sc = " << 1.0/m_Schmidt_inv
                        << " and Pr = " << 1.0/m_Prandtl_inv << std::endl;
@@ -313,8 +318,57 @@ void PeleLM::readParameters() {
    pp.query("deltaT_iterMax",m_deltaTIterMax);
    pp.query("deltaT_tol",m_deltaT_norm_max);
    pp.query("deltaT_crashIfFailing",m_crashOnDeltaTFail);
+   pp.query("diffusion_warm_start",m_diffWarmStart);
+   if (m_diffWarmStart < 0 || m_diffWarmStart > 3) {
+      amrex::Abort("peleLM.diffusion_warm_start must be 0, 1, 2 or 3");
+   }
+   pp.query("fused_species_fluxes",m_use_fusedSpeciesFluxes);
+   pp.query("vel_diff_explicit_cfl",m_velDiffExplicitCFL);
+   pp.query("vel_diff_explicit_check",m_velDiffExplicitCheck);
+   pp.query("deltaT_anderson_depth",m_deltaTAndersonDepth);
+   if (m_deltaTAndersonDepth < 0) {
+      amrex::Abort("peleLM.deltaT_anderson_depth must be >= 0");
+   }
    ParmParse pptrans("transport");
    pptrans.query("use_soret",m_use_soret);
+   // Reuse the face-centered transport coefficients until the next calcDiffusivity/calcViscosity
+   pp.query("use_face_coeff_cache",m_use_faceCoeffCache);
+   pp.query("use_fillpatch_cache",m_use_fillPatchCache);
+
+   // Evaluate viscosity, diffusivities and cp in a single kernel when computed together
+   pp.query("fused_transport",m_use_fusedTransport);
+
+   // Tabulated pure-species transport properties
+   pp.query("transport_table",m_use_transTable);
+   if (m_use_transTable) {
+      if (m_use_soret) {
+         amrex::Abort("peleLM.transport_table is not available with Soret effects");
+      }
+      if (m_unity_Le) {
+         amrex::Print() << "WARNING: peleLM.transport_table only used for the viscosity with unity_Le\n";
+      }
+      m_transTable = std::make_unique<TransportTableData>();
+      m_transTable->nPts = 1024;
+      m_transTable->Tmin = 200.0;
+      m_transTable->Tmax = 3500.0;
+      pp.query("transport_table_npts",m_transTable->nPts);
+      pp.query("transport_table_Tmin",m_transTable->Tmin);
+      pp.query("transport_table_Tmax",m_transTable->Tmax);
+      std::string interp = "linear";
+      pp.query("transport_table_interp",interp);
+      if (interp == "cubic") {
+         m_transTable->cubic = 1;
+      } else if (interp != "linear") {
+         amrex::Abort("peleLM.transport_table_interp must be linear or cubic");
+      }
+      if (m_transTable->nPts < 4 || m_transTable->Tmax <= m_transTable->Tmin) {
+         amrex::Abort("peleLM.transport_table needs at least 4 points and Tmax > Tmin");
+      }
+      pp.query("transport_table_check_int",m_transTableCheckInt);
+      pp.query("transport_table_check_stride",m_transTableCheckStride);
+      pp.query("transport_table_check_tol",m_transTableCheckTol);
+      m_transTableCheckStride = std::max(1,m_transTableCheckStride);
+   }
 
    if (m_do_les or m_unity_Le) {
      amrex::Real Prandtl = 0.7;
@@ -352,6 +406,34 @@ void PeleLM::readParameters() {
       m_plotHeatRelease = 1;
       pp.query("plot_chemDiagnostics",m_plotChemDiag);
       pp.query("plot_heatRelease",m_plotHeatRelease);
+      // Integrate the chemistry on packed batches of cells instead of tiles
+      pp.query("chem_batch_size",m_chemBatchSize);
+      // Stiffness bins: thresholds on the previous step function call count
+      int nFctCBins = pp.countval("chem_functC_bins");
+      if (nFctCBins > 0) {
+         pp.getarr("chem_functC_bins",m_chemFunctCBins,0,nFctCBins);
+         if (m_chemBatchSize <= 0) {
+            Abort("peleLM.chem_functC_bins requires peleLM.chem_batch_size > 0");
+         }
+         if (!std::is_sorted(m_chemFunctCBins.begin(),m_chemFunctCBins.end())) {
+            Abort("peleLM.chem_functC_bins should be provided in increasing order");
+         }
+      }
+#ifdef PELE_USE_EFIELD
+      if (m_chemBatchSize > 0) {
+         Abort("peleLM.chem_batch_size is not available with EFIELD");
+      }
+#endif
+      // Skip the chemistry integration in chemically frozen cells
+      pp.query("chem_frozen_skip",m_chemFrozenSkip);
+      pp.query("chem_frozen_Tmax",m_chemFrozenTmax);
+      pp.query("chem_frozen_Yrad_max",m_chemFrozenYradMax);
+      pp.query("chem_frozen_IR_max",m_chemFrozenIRMax);
+#ifdef PELE_USE_EFIELD
+      if (m_chemFrozenSkip) {
+         Abort("peleLM.chem_frozen_skip is not available for EFIELD builds");
+      }
+#endif
    }
    // Enable the chemistry BA to have smaller grid size
    int mgsc_size = pp.countval("max_grid_size_chem");
@@ -435,6 +517,7 @@ void PeleLM::readParameters() {
    ppnproj.query("atol",m_nodal_mg_atol);
    ppnproj.query("rtol",m_nodal_mg_rtol);
    ppnproj.query("hypre_namespace",m_hypre_namespace_nodal);
+   ppnproj.query("reuse_projector",m_nodal_reuse_projector);
 
    ParmParse ppmacproj("mac_proj");
    ppmacproj.query("mg_max_coarsening_level",m_mac_mg_max_coarsening_level);
@@ -451,8 +534,31 @@ void PeleLM::readParameters() {
       pp.query("do_extremas",m_do_extremas);
       pp.query("do_mass_balance",m_do_massBalance);
       pp.query("do_species_balance",m_do_speciesBalance);
+      pp.query("do_reaction_entropy",m_do_reacEntropy);
+      pp.query("reaction_entropy_topK",m_reacEntropy_topK);
+      if (m_do_reacEntropy && m_incompressible) {
+         amrex::Abort("peleLM.do_reaction_entropy is not available for incompressible simulations");
+      }
+      AMREX_ALWAYS_ASSERT(m_reacEntropy_topK > 0);
    }
 
+   // -----------------------------------------
+   // Sampled dump of derived variables
+   // -----------------------------------------
+   readSampleDumpParameters();
+
+   // -----------------------------------------
+   // Time-integrated entropy generation
+   // -----------------------------------------
+   pp.query("do_entropy_average",m_do_entropyAvg);
+   if (m_do_entropyAvg && m_incompressible) {
+      amrex::Abort("peleLM.do_entropy_average is not available for incompressible simulations");
+   }
+   // Keep the new-time diffusion fluxes for the entropy_generation derive
+   m_keepEntropyDiffFluxes = m_do_entropyAvg
+                             || (std::find(m_derivePlotVars.begin(), m_derivePlotVars.end(), "entropy_generation")
+                                 != m_derivePlotVars.end());
+
    // -----------------------------------------
    // Time stepping control
    // -----------------------------------------
@@ -596,6 +702,22 @@ void PeleLM::readIOParameters() {
    pp.query("regrid_file", m_regrid_file);
    pp.query("file_stepDigits", m_ioDigits);
    pp.query("use_hdf5_plt",m_write_hdf5_pltfile);
+   pp.query("plot_float32",m_plot_float32);
+   int nQuantize = pp.countval("plot_quantize");
+   if (nQuantize > 0) {
+      m_plotQuantize.resize(nQuantize);
+      pp.getarr("plot_quantize",m_plotQuantize,0,nQuantize);
+   }
+   pp.query("plot_compression",m_plot_compression);
+   // The asynchronous VisMF writer always writes native reals, ignoring the FAB format
+#ifdef AMREX_USE_HDF5
+   const bool nativePlt = !m_write_hdf5_pltfile;
+#else
+   const bool nativePlt = true;
+#endif
+   if (m_plot_float32 && nativePlt && AsyncOut::UseAsyncOut()) {
+      amrex::Abort("amr.plot_float32 is not available with amr.async_output for native plotfiles");
+   }
    pp.query("regrid_interp_method",m_regrid_interp_method);
    AMREX_ASSERT(m_regrid_interp_method == 0 || m_regrid_interp_method == 1);
 
@@ -734,6 +856,23 @@ void PeleLM::variablesSetup() {
          fuelID = stateVariableIndex(fuel_name);
          fuelID -= FIRSTSPEC;
       }
+
+      // Radicals used to detect chemically frozen cells
+      if (m_do_react && m_chemFrozenSkip) {
+         int nRad = pp.countval("chem_frozen_radicals");
+         Vector<std::string> radNames(nRad);
+         if (nRad > 0) pp.getarr("chem_frozen_radicals",radNames,0,nRad);
+         Vector<int> radIDs;
+         for (const auto& rad : radNames) {
+            std::string rad_name = "rho.Y("+rad+")";
+            if (!isStateVariable(rad_name)) {
+               Abort("peleLM.chem_frozen_radicals: unknown species "+rad);
+            }
+            radIDs.push_back(stateVariableIndex(rad_name)-FIRSTSPEC);
+         }
+         m_chemFrozenRadicals.resize(radIDs.size());
+         Gpu::copy(Gpu::hostToDevice, radIDs.begin(), radIDs.end(), m_chemFrozenRadicals.begin());
+      }
    }
 
    if (max_level > 0 && !m_initial_grid_file.empty()) {
@@ -881,9 +1020,17 @@ void PeleLM::derivedSetup()
 
 
    
-      // EITERM4
-   derive_lst.add("EITERM4",IndexType::TheCellType(),1,pelelm_derEIterm4,the_same_box);
-   
+   // EITERM4
+   if (!m_incompressible) {
+      initReactionStoichiometry();
+      derive_lst.add("EITERM4",IndexType::TheCellType(),1,pelelm_derEIterm4,the_same_box);
+
+      // Entropy generation budget
+      Vector<std::string> var_names({"entropy_gen_heat","entropy_gen_visc",
+                                     "entropy_gen_diff","entropy_gen_chem"});
+      derive_lst.add("entropy_generation",IndexType::TheCellType(),4,var_names,
+                     pelelm_derentropygen,grow_box_by_one);
+   }
 
    {
        Vector<std::string> var_names = pelelm_setuserderives();
@@ -1123,6 +1270,10 @@ void PeleLM::resizeArray() {
    m_baChem.resize(max_level+1);
    m_dmapChem.resize(max_level+1);
    m_baChemFlag.resize(max_level+1);
+   m_chemBAData.resize(max_level+1);
+   m_faceCoeffCache.resize(max_level+1);
+   m_fpStateCache.resize(max_level+1);
+   m_fpReactCache.resize(max_level+1);
 
 #ifdef PELE_USE_EFIELD
    m_leveldatanlsolve.resize(max_level+1);
@@ -1132,6 +1283,9 @@ void PeleLM::resizeArray() {
    // External sources
    m_extSource.resize(max_level+1);
 
+   // Time-integrated entropy generation
+   m_entropyGenSum.resize(max_level+1);
+
    // Factory
    m_factory.resize(max_level+1);
 
@@ -0,0 +1,281 @@
+#include <PeleLM.H>
+#include <algorithm>
+
+using namespace amrex;
+
+void PeleLM::createSliceOutput()
+{
+   ParmParse pp("peleLM.sliceOutput");
+
+   int nRegions = pp.countval("regions");
+   if (nRegions == 0) return;
+   Vector<std::string> regions(nRegions);
+   pp.getarr("regions",regions,0,nRegions);
+
+   // Regions: planes span the domain except along their normal
+   const auto prob_lo = geom[0].ProbLoArray();
+   const auto prob_hi = geom[0].ProbHiArray();
+   m_sliceRegions.resize(nRegions);
+   for (int r = 0; r < nRegions; ++r) {
+      ParmParse ppr("peleLM.sliceOutput." + regions[r]);
+      SliceRegion& region = m_sliceRegions[r];
+      region.name = regions[r];
+      ppr.get("type",region.type);
+      for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+         region.lo[idim] = prob_lo[idim];
+         region.hi[idim] = prob_hi[idim];
+      }
+      if (region.type == "plane") {
+         int normal = 0;
+         Real center = 0.0;
+         ppr.get("normal",normal);
+         ppr.get("center",center);
+         if (normal < 0 || normal >= AMREX_SPACEDIM) {
+            amrex::Abort("peleLM.sliceOutput."+region.name+".normal must be in [0,AMREX_SPACEDIM)");
+         }
+         region.lo[normal] = center;
+         region.hi[normal] = center;
+      } else if (region.type == "box") {
+         Vector<Real> lo(AMREX_SPACEDIM), hi(AMREX_SPACEDIM);
+         ppr.getarr("lo",lo,0,AMREX_SPACEDIM);
+         ppr.getarr("hi",hi,0,AMREX_SPACEDIM);
+         for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            region.lo[idim] = lo[idim];
+            region.hi[idim] = hi[idim];
+         }
+      } else {
+         amrex::Abort("peleLM.sliceOutput."+region.name+".type must be plane or box");
+      }
+   }
+
+   // Variables: multi-component derives are expanded into their components
+   int nVars = pp.countval("vars");
+   if (nVars == 0) {
+      amrex::Abort("peleLM.sliceOutput.vars must be provided along with peleLM.sliceOutput.regions");
+   }
+   Vector<std::string> vars(nVars);
+   pp.getarr("vars",vars,0,nVars);
+   for (auto &v : vars) {
+      bool itexists = derive_lst.canDerive(v) || isStateVariable(v) || isReactVariable(v);
+      if (!itexists) {
+         amrex::Abort("Field "+v+" is not available");
+      }
+      const PeleLMDeriveRec* rec = derive_lst.get(v);
+      if (rec && rec->variableComp(v) < 0) {
+         for (int n = 0; n < rec->numDerive(); ++n) {
+            m_sliceVars.push_back(rec->variableName(n));
+         }
+      } else {
+         m_sliceVars.push_back(v);
+      }
+   }
+
+   pp.query("int",m_slice_int);
+   pp.query("max_level",m_slice_max_level);
+   pp.query("file",m_sliceFile);
+   if (m_slice_int <= 0) {
+      amrex::Abort("peleLM.sliceOutput.int must be > 0");
+   }
+
+   // ASCII description of each region binary file
+   if (ParallelDescriptor::IOProcessor()) {
+      for (const auto& region : m_sliceRegions) {
+         const std::string hdrName = m_sliceFile + "_" + region.name + ".hdr";
+         std::ofstream hdrFile(hdrName.c_str(), std::ios::out | std::ios::trunc);
+         if (!hdrFile.good()) {
+            amrex::FileOpenFailed(hdrName);
+         }
+         hdrFile << region.type << "\n";
+         hdrFile << AMREX_SPACEDIM << "\n";
+         for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            hdrFile << region.lo[idim] << " ";
+         }
+         hdrFile << "\n";
+         for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            hdrFile << region.hi[idim] << " ";
+         }
+         hdrFile << "\n";
+         hdrFile << sizeof(Real) << "\n";
+         hdrFile << m_sliceVars.size() << "\n";
+         for (const auto& v : m_sliceVars) {
+            hdrFile << v << "\n";
+         }
+      }
+   }
+}
+
+bool PeleLM::writeSliceNow()
+{
+   return ( !m_sliceRegions.empty() && m_slice_int > 0 && (m_nstep % m_slice_int == 0) );
+}
+
+Box PeleLM::sliceRegionBox(const SliceRegion &a_region, int lev)
+{
+   // Cells of lev containing the region extent, clipped to the domain
+   const auto prob_lo = geom[lev].ProbLoArray();
+   const auto dxinv   = geom[lev].InvCellSizeArray();
+   IntVect lo, hi;
+   for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+      lo[idim] = static_cast<int>(std::floor((a_region.lo[idim]-prob_lo[idim])*dxinv[idim]));
+      hi[idim] = static_cast<int>(std::floor((a_region.hi[idim]-prob_lo[idim])*dxinv[idim]));
+   }
+   return Box(lo,hi) & geom[lev].Domain();
+}
+
+void PeleLM::WriteSliceOutput()
+{
+   BL_PROFILE("PeleLM::WriteSliceOutput()");
+
+   const int nRegions = static_cast<int>(m_sliceRegions.size());
+   const int nVars = static_cast<int>(m_sliceVars.size());
+   const int maxLev = (m_slice_max_level >= 0) ? std::min(m_slice_max_level, finestLevel())
+                                               : finestLevel();
+   const int nHdr = 1 + 2*AMREX_SPACEDIM;
+
+   bool needReact = false;
+   for (const auto& v : m_sliceVars) {
+      needReact = needReact || derive_lst.get(v) || isReactVariable(v);
+   }
+   needReact = needReact && !m_incompressible;
+
+   // Per-rank buffers of each region: box headers (level, lo, hi) and box data
+   Vector<Vector<int>> boxHeaders(nRegions);
+   Vector<Vector<Real>> boxData(nRegions);
+
+   for (int lev = 0; lev <= maxLev; ++lev) {
+
+      // Intersection of the level grids with the regions, minus the cells covered
+      // by the next written level. The region boxes keep the owner of their grid.
+      BoxArray fineBA;
+      if (lev < maxLev) fineBA = amrex::coarsen(grids[lev+1], refRatio(lev));
+      BoxList subBL;
+      Vector<int> subRegion;
+      Vector<int> subPMap;
+      for (int r = 0; r < nRegions; ++r) {
+         const Box rbx = sliceRegionBox(m_sliceRegions[r], lev);
+         if (!rbx.ok()) continue;
+         for (const auto& isect : grids[lev].intersections(rbx)) {
+            BoxList bl = (lev < maxLev) ? fineBA.complementIn(isect.second) : BoxList(isect.second);
+            for (const Box& bx : bl) {
+               subBL.push_back(bx);
+               subRegion.push_back(r);
+               subPMap.push_back(dmap[lev][isect.first]);
+            }
+         }
+      }
+      if (subBL.isEmpty()) continue;
+      const BoxArray subBA(subBL);
+      const DistributionMapping subDM(subPMap);
+
+      // FillPatch the state/reaction on the region boxes only
+      const int nCompState = (m_incompressible) ? AMREX_SPACEDIM : NVAR;
+      MultiFab stateSub(subBA, subDM, nCompState, m_nGrowState);
+      fillpatch_state(lev, m_cur_time, stateSub, m_nGrowState);
+      MultiFab reactSub;
+      if (needReact) {
+         reactSub.define(subBA, subDM, nCompIR(), 0);
+         fillpatch_reaction(lev, m_cur_time, reactSub, 0);
+      }
+      // Get pressure: no fillpatch for pressure, simply get new state
+      auto ldata_p = getLevelDataPtr(lev,AmrNewTime);
+      MultiFab pressSub(amrex::convert(subBA,IntVect::TheNodeVector()), subDM, 1, 0);
+      pressSub.ParallelCopy(ldata_p->press);
+      auto stateBCs = fetchBCRecArray(VELX,NVAR);
+
+      // Evaluate the variables, components of the same derive are derived once
+      MultiFab subMF(subBA, subDM, nVars, 0);
+      Vector<int> done(nVars,0);
+      for (int v = 0; v < nVars; ++v) {
+         if (done[v]) continue;
+         const PeleLMDeriveRec* rec = derive_lst.get(m_sliceVars[v]);
+         if (rec) {
+            MultiFab derTemp(subBA, subDM, rec->numDerive(), 0);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+            for (MFIter mfi(derTemp,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+            {
+               const Box& bx = mfi.tilebox();
+               FArrayBox& derfab = derTemp[mfi];
+               FArrayBox const& statefab = stateSub[mfi];
+               FArrayBox const& reactfab = (m_incompressible) ? pressSub[mfi] : reactSub[mfi];
+               FArrayBox const& pressfab = pressSub[mfi];
+               rec->derFunc()(this, bx, derfab, 0, rec->numDerive(), statefab, reactfab, pressfab, geom[lev], m_cur_time, stateBCs, lev);
+            }
+            for (int w = v; w < nVars; ++w) {
+               if (!done[w] && derive_lst.get(m_sliceVars[w]) == rec) {
+                  MultiFab::Copy(subMF, derTemp, rec->variableComp(m_sliceVars[w]), w, 1, 0);
+                  done[w] = 1;
+               }
+            }
+         } else if (isStateVariable(m_sliceVars[v])) {
+            MultiFab::Copy(subMF, stateSub, stateVariableIndex(m_sliceVars[v]), v, 1, 0);
+            done[v] = 1;
+         } else {
+            MultiFab::Copy(subMF, reactSub, reactVariableIndex(m_sliceVars[v]), v, 1, 0);
+            done[v] = 1;
+         }
+      }
+
+      // Pack the local boxes: header, then each variable in Fortran order
+      for (MFIter mfi(subMF); mfi.isValid(); ++mfi) {
+         const Box& bx = mfi.validbox();
+         const int r = subRegion[mfi.index()];
+         boxHeaders[r].push_back(lev);
+         for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            boxHeaders[r].push_back(bx.smallEnd(idim));
+         }
+         for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            boxHeaders[r].push_back(bx.bigEnd(idim));
+         }
+         const Long nData = bx.numPts() * nVars;
+         FArrayBox hostfab(bx, nVars, The_Pinned_Arena());
+         hostfab.copy<RunOn::Device>(subMF[mfi], bx, 0, bx, 0, nVars);
+         Gpu::streamSynchronize();
+         boxData[r].insert(boxData[r].end(), hostfab.dataPtr(), hostfab.dataPtr() + nData);
+      }
+   }
+
+   // Gather each region per-rank buffers on the IO processor, in rank order
+   const int ioProc = ParallelDescriptor::IOProcessorNumber();
+   const int nProcs = ParallelDescriptor::NProcs();
+   auto gatherIO = [=] (const auto& a_local, auto& a_all)
+   {
+      int sendCount = static_cast<int>(a_local.size());
+      std::vector<int> recvCounts(nProcs,0);
+      ParallelDescriptor::Gather(&sendCount, 1, recvCounts.data(), 1, ioProc);
+      std::vector<int> disp(nProcs,0);
+      for (int p = 1; p < nProcs; ++p) {
+         disp[p] = disp[p-1] + recvCounts[p-1];
+      }
+      a_all.resize(ParallelDescriptor::IOProcessor() ? disp[nProcs-1] + recvCounts[nProcs-1] : 0);
+      ParallelDescriptor::Gatherv(a_local.data(), sendCount, a_all.data(), recvCounts, disp, ioProc);
+   };
+
+   for (int r = 0; r < nRegions; ++r) {
+      Vector<int> allHeaders;
+      Vector<Real> allData;
+      gatherIO(boxHeaders[r], allHeaders);
+      gatherIO(boxData[r], allData);
+
+      if (ParallelDescriptor::IOProcessor()) {
+         // Binary record: step, time, number of boxes, then for each box its level,
+         // lo and hi (ints) and finally the boxes data in the same order
+         const std::string fileName = m_sliceFile + "_" + m_sliceRegions[r].name;
+         std::ofstream sliceFile(fileName.c_str(), std::ios::out | std::ios::app | std::ios_base::binary);
+         if (!sliceFile.good()) {
+            amrex::FileOpenFailed(fileName);
+         }
+         const int nBoxes = static_cast<int>(allHeaders.size()) / nHdr;
+         sliceFile.write(reinterpret_cast<const char*>(&m_nstep), sizeof(int));
+         sliceFile.write(reinterpret_cast<const char*>(&m_cur_time), sizeof(Real));
+         sliceFile.write(reinterpret_cast<const char*>(&nBoxes), sizeof(int));
+         sliceFile.write(reinterpret_cast<const char*>(allHeaders.data()), allHeaders.size()*sizeof(int));
+         sliceFile.write(reinterpret_cast<const char*>(allData.data()), allData.size()*sizeof(Real));
+      }
+   }
+
+   if (m_verbose > 1) {
+      amrex::Print() << " Slice output written for " << nRegions << " region(s) at step " << m_nstep << "\n";
+   }
+}
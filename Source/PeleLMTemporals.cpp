@@ -1,4 +1,6 @@
 #include <PeleLM.H>
+#include <PeleLM_K.H>
+#include <numeric>
 
 using namespace amrex;
 
@@ -80,6 +82,177 @@ void PeleLM::speciesBalance()
    tmpSpecFile.flush();
 }
 
+void PeleLM::reactionEntropyBalance()
+{
+   BL_PROFILE("PeleLM::reactionEntropyBalance()");
+
+   // Per-reaction chemical entropy production -(q_f-q_r)*DG_j/T, integrated
+   // over the uncovered domain, along with the K cells of largest total
+   // chemical entropy production and their dominant reaction.
+   AMREX_ASSERT(m_stoichRowPtr.size() == NUM_REACTIONS+1);
+   const int*  rowPtr  = m_stoichRowPtr.data();
+   const int*  specIdx = m_stoichSpecIdx.data();
+   const Real* nuCoef  = m_stoichCoef.data();
+
+   const int topK = m_reacEntropy_topK;
+   constexpr int candSize = 2 + AMREX_SPACEDIM;    // value, dominant reaction, cell center
+
+   Vector<Real> reacIntHost(NUM_REACTIONS, 0.0);
+   Vector<Real> allCand;
+
+   for (int lev = 0; lev <= finest_level; ++lev) {
+
+      // Cell volume, accounting for EB and 2D-RZ
+#ifdef AMREX_USE_EB
+      const Real* dx = geom[lev].CellSize();
+      const Real dvol = AMREX_D_TERM(dx[0],*dx[1],*dx[2]);
+      MultiFab volume(grids[lev], dmap[lev], 1, 0);
+      auto const& ebfact = dynamic_cast<EBFArrayBoxFactory const&>(Factory(lev));
+      MultiFab::Copy(volume, ebfact.getVolFrac(), 0, 0, 1, 0);
+      volume.mult(dvol);
+#else
+      MultiFab volume(grids[lev], dmap[lev], 1, 0);
+      geom[lev].GetVolume(volume);
+#endif
+      // Discard fine-covered cells
+      if (lev != finest_level) {
+         MultiFab::Multiply(volume, amrex::ToMultiFab(*m_coveredMask[lev]), 0, 0, 1, 0);
+      }
+
+      // Per-reaction volume-weighted production, total production and dominant reaction
+      MultiFab sgenReac(grids[lev], dmap[lev], NUM_REACTIONS, 0);
+      MultiFab sgenChem(grids[lev], dmap[lev], 2, 0);
+      auto const& sma    = m_leveldata_new[lev]->state.const_arrays();
+      auto const& vola   = volume.const_arrays();
+      auto const& sreaca = sgenReac.arrays();
+      auto const& sgena  = sgenChem.arrays();
+      amrex::ParallelFor(sgenChem, [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept
+      {
+         auto const rho  = Array4<Real const>(sma[box_no],DENSITY);
+         auto const rhoY = Array4<Real const>(sma[box_no],FIRSTSPEC);
+         auto const T    = Array4<Real const>(sma[box_no],TEMP);
+         const Real vol = vola[box_no](i,j,k);
+         if (vol <= 0.0) {
+            for (int n = 0; n < NUM_REACTIONS; n++) {
+               sreaca[box_no](i,j,k,n) = 0.0;
+            }
+            sgena[box_no](i,j,k,0) = std::numeric_limits<Real>::lowest();
+            sgena[box_no](i,j,k,1) = -1.0;
+            return;
+         }
+         Real EI_j[NUM_REACTIONS] = {0.0};
+         const Real EI = getChemEntropyProd(i, j, k, rho, rhoY, T,
+                                            rowPtr, specIdx, nuCoef, EI_j);
+         const Real Tinv = 1.0 / T(i,j,k);
+         Real EImin = 0.0;
+         int EIminInd = -1;
+         for (int n = 0; n < NUM_REACTIONS; n++) {
+            sreaca[box_no](i,j,k,n) = -EI_j[n] * Tinv * vol;
+            if (EI_j[n] < EImin) {
+               EImin = EI_j[n];
+               EIminInd = n;
+            }
+         }
+         sgena[box_no](i,j,k,0) = -EI * Tinv;
+         sgena[box_no](i,j,k,1) = static_cast<Real>(EIminInd);
+      });
+
+      // Local domain integrals
+      for (int n = 0; n < NUM_REACTIONS; n++) {
+         reacIntHost[n] += sgenReac.sum(n, true);
+      }
+
+      // Top-K cells of the level, selected on device: each pass reduces the
+      // largest production below the previous one, then the smallest
+      // (cell, reaction) key carrying it. Only scalars leave the device.
+      const Box& domain = geom[lev].Domain();
+      const auto dlo  = amrex::lbound(domain);
+      const auto dlen = amrex::length(domain);
+      const auto prob_lo = geom[lev].ProbLoArray();
+      const auto dx_lev  = geom[lev].CellSizeArray();
+      auto const& sgenca = sgenChem.const_arrays();
+      Real prevMax = std::numeric_limits<Real>::max();
+      for (int c = 0; c < topK; ++c) {
+         Real valMax = ParReduce(TypeList<ReduceOpMax>{}, TypeList<Real>{}, sgenChem, IntVect(0),
+         [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept -> GpuTuple<Real>
+         {
+            auto const& sgen = sgenca[box_no];
+            if (sgen(i,j,k,1) < 0.0 || sgen(i,j,k,0) >= prevMax) {
+               return std::numeric_limits<Real>::lowest();
+            }
+            return sgen(i,j,k,0);
+         });
+         ParallelAllReduce::Max(valMax, ParallelContext::CommunicatorSub());
+         if (valMax == std::numeric_limits<Real>::lowest()) break;
+
+         Long keyMin = ParReduce(TypeList<ReduceOpMin>{}, TypeList<Long>{}, sgenChem, IntVect(0),
+         [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept -> GpuTuple<Long>
+         {
+            auto const& sgen = sgenca[box_no];
+            if (sgen(i,j,k,1) < 0.0 || sgen(i,j,k,0) != valMax) {
+               return std::numeric_limits<Long>::max();
+            }
+            const Long cell = (i-dlo.x) + static_cast<Long>(dlen.x) * ((j-dlo.y) + static_cast<Long>(dlen.y) * (k-dlo.z));
+            return cell * NUM_REACTIONS + static_cast<Long>(sgen(i,j,k,1));
+         });
+         ParallelAllReduce::Min(keyMin, ParallelContext::CommunicatorSub());
+
+         const Long cell = keyMin / NUM_REACTIONS;
+         const IntVect iv(AMREX_D_DECL(dlo.x + static_cast<int>(cell % dlen.x),
+                                       dlo.y + static_cast<int>((cell / dlen.x) % dlen.y),
+                                       dlo.z + static_cast<int>(cell / (static_cast<Long>(dlen.x) * dlen.y))));
+         allCand.push_back(valMax);
+         allCand.push_back(static_cast<Real>(keyMin % NUM_REACTIONS));
+         for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            allCand.push_back(prob_lo[idim] + (iv[idim]+0.5)*dx_lev[idim]);
+         }
+         prevMax = valMax;
+      }
+   }
+
+   // Domain integrals, reduced on the IO processor
+   ParallelDescriptor::ReduceRealSum(reacIntHost.data(), NUM_REACTIONS, ParallelDescriptor::IOProcessorNumber());
+
+   if (ParallelDescriptor::IOProcessor()) {
+      // Global top-K from the per-level candidates, already reduced across ranks
+      const int nCand = static_cast<int>(allCand.size()) / candSize;
+      const int nTop = std::min(topK, nCand);
+      Vector<int> order(nCand);
+      std::iota(order.begin(), order.end(), 0);
+      std::partial_sort(order.begin(), order.begin()+nTop, order.end(),
+                        [&allCand](int a, int b) { return allCand[a*candSize] > allCand[b*candSize]; });
+
+      // Report reactions using the mechanism ordering
+      Vector<int> rmap(NUM_REACTIONS);
+      GET_RMAP(rmap.dataPtr());
+      Vector<Real> reacIntMech(NUM_REACTIONS);
+      for (int n = 0; n < NUM_REACTIONS; n++) {
+         reacIntMech[rmap[n]] = reacIntHost[n];
+      }
+
+      // Binary record: step, time, nReactions, K, integrals, then K x (value, reaction, cell center)
+      // Missing candidates (fewer than K uncovered cells with a dominant reaction) are padded.
+      const int nReac = NUM_REACTIONS;
+      tmpReacEntropyFile.write(reinterpret_cast<const char*>(&m_nstep), sizeof(int));
+      tmpReacEntropyFile.write(reinterpret_cast<const char*>(&m_cur_time), sizeof(Real));
+      tmpReacEntropyFile.write(reinterpret_cast<const char*>(&nReac), sizeof(int));
+      tmpReacEntropyFile.write(reinterpret_cast<const char*>(&topK), sizeof(int));
+      tmpReacEntropyFile.write(reinterpret_cast<const char*>(reacIntMech.data()), nReac*sizeof(Real));
+      Array<Real,candSize> padding;
+      padding.fill(0.0);
+      padding[0] = std::numeric_limits<Real>::lowest();
+      padding[1] = -1.0;
+      for (int c = 0; c < topK; ++c) {
+         const Real* cand = (c < nTop) ? &allCand[order[c]*candSize] : padding.data();
+         const int reac = (cand[1] >= 0.0) ? rmap[static_cast<int>(cand[1])] : -1;
+         tmpReacEntropyFile.write(reinterpret_cast<const char*>(&cand[0]), sizeof(Real));
+         tmpReacEntropyFile.write(reinterpret_cast<const char*>(&reac), sizeof(int));
+         tmpReacEntropyFile.write(reinterpret_cast<const char*>(&cand[2]), AMREX_SPACEDIM*sizeof(Real));
+      }
+      tmpReacEntropyFile.flush();
+   }
+}
+
 void PeleLM::addMassFluxes(const Array<const MultiFab*,AMREX_SPACEDIM> &a_fluxes,
                            const Geometry& a_geom)
 {
@@ -481,6 +654,12 @@ void PeleLM::writeTemporals()
       speciesBalance();
    }
 
+   //----------------------------------------------------------------
+   // Per-reaction entropy production
+   if (m_do_reacEntropy && !m_incompressible) {
+      reactionEntropyBalance();
+   }
+
    //----------------------------------------------------------------
    // State
    // Get kinetic energy and enstrophy
@@ -556,6 +735,10 @@ void PeleLM::openTempFile()
          tmpSpecFile.open(tempFileName.c_str(),std::ios::out | std::ios::app | std::ios_base::binary);
          tmpSpecFile.precision(12);
       }
+      if (m_do_reacEntropy) {
+         tempFileName = "temporals/tempEntropyReactions";
+         tmpReacEntropyFile.open(tempFileName.c_str(),std::ios::out | std::ios::app | std::ios_base::binary);
+      }
       if (m_do_extremas) {
          tempFileName = "temporals/tempExtremas";
          tmpExtremasFile.open(tempFileName.c_str(),std::ios::out | std::ios::app | std::ios_base::binary);
@@ -586,6 +769,10 @@ void PeleLM::closeTempFile()
          tmpSpecFile.flush();
          tmpSpecFile.close();
       }
+      if (m_do_reacEntropy) {
+         tmpReacEntropyFile.flush();
+         tmpReacEntropyFile.close();
+      }
       if (m_do_extremas) {
          tmpExtremasFile.flush();
          tmpExtremasFile.close();
@@ -5,15 +5,39 @@
 #ifdef PELE_USE_EFIELD
 #include <PeleLMEF_K.H>
 #endif
+#include <algorithm>
 
 using namespace amrex;
 
+namespace {
+// Device view of the tabulated transport properties
+template <class TableData>
+TransportTableView
+getTransportTableView(TableData const& a_tab)
+{
+   TransportTableView view;
+   view.mu = a_tab.mu.data();
+   view.lambda = a_tab.lambda.data();
+   view.PD = a_tab.PD.data();
+   view.nPts = a_tab.nPts;
+   view.cubic = a_tab.cubic;
+   view.Tmin = a_tab.Tmin;
+   view.dTinv = (a_tab.nPts - 1) / (a_tab.Tmax - a_tab.Tmin);
+   return view;
+}
+}
+
 void PeleLM::calcTurbViscosity(const TimeStamp &a_time) {
    BL_PROFILE("PeleLM::calcTurbViscosity()");
 
    // We shouldn't be here unless we're doing LES
    AMREX_ALWAYS_ASSERT(m_do_les);
 
+   // Cached face-centered coefficients might include the turbulent contribution
+   for (int lev = 0; lev <= finest_level; ++lev) {
+      invalidateFaceCoeffCache(lev);
+   }
+
    if (m_les_verbose > 0) {
      amrex::Print() << "   Computing Turbulent Viscosity with LES model: " << m_les_model
                     << " for time " << getTime(0, a_time) << std::endl;
@@ -56,20 +80,25 @@ void PeleLM::calcTurbViscosity(const TimeStamp &a_time) {
        }
      } else {
        // get cp_cc (valid in 1 grow cell for interpolation to FCs)
+       // reuse the cp from the fused transport evaluation of the old state if available
        int ngrow = 1;
-       cp_cc.define(ba, dm, 1, ngrow, MFInfo(), factory);
-       auto const& state_arr      = ldata_p->state.const_arrays();
-       auto const& cp_arr       = cp_cc.arrays();
-       amrex::ParallelFor(cp_cc, cp_cc.nGrowVect(), [=]
-                          AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept
-                          {
-                            getCpmixGivenRYT( i, j, k,
-                                              Array4<Real const>(state_arr[box_no], DENSITY),
-                                              Array4<Real const>(state_arr[box_no], FIRSTSPEC),
-                                              Array4<Real const>(state_arr[box_no], TEMP),
-                                              Array4<Real      >(cp_arr[box_no]) );
-                          });
-       Gpu::streamSynchronize();
+       if (a_time == AmrOldTime && ldata_p->cp_time == getTime(lev,a_time)) {
+         cp_cc = MultiFab(ldata_p->cp_cc, amrex::make_alias, 0, 1);
+       } else {
+         cp_cc.define(ba, dm, 1, ngrow, MFInfo(), factory);
+         auto const& state_arr      = ldata_p->state.const_arrays();
+         auto const& cp_arr       = cp_cc.arrays();
+         amrex::ParallelFor(cp_cc, cp_cc.nGrowVect(), [=]
+                            AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept
+                            {
+                              getCpmixGivenRYT( i, j, k,
+                                                Array4<Real const>(state_arr[box_no], DENSITY),
+                                                Array4<Real const>(state_arr[box_no], FIRSTSPEC),
+                                                Array4<Real const>(state_arr[box_no], TEMP),
+                                                Array4<Real      >(cp_arr[box_no]) );
+                            });
+         Gpu::streamSynchronize();
+       }
 
        // this function really just interpolates CCs to FCs in this case
        int doZeroVisc = 0;
@@ -217,6 +246,112 @@ void PeleLM::calcTurbViscosity(const TimeStamp &a_time) {
    }
 }
 
+void PeleLM::calcTransport(const TimeStamp &a_time) {
+   BL_PROFILE("PeleLM::calcTransport()");
+
+   if (!m_use_fusedTransport || m_incompressible) {
+      calcViscosity(a_time);
+      if (!m_incompressible) {
+         calcDiffusivity(a_time);
+      }
+      return;
+   }
+
+   for (int lev = 0; lev <= finest_level; ++lev) {
+
+      auto ldata_p = getLevelDataPtr(lev,a_time);
+
+      invalidateFaceCoeffCache(lev, &ldata_p->visc_cc);
+      invalidateFaceCoeffCache(lev, &ldata_p->diff_cc);
+
+      // Transport data pointer
+      auto const* ltransparm = trans_parms.device_trans_parm();
+
+      // MultiArrays
+      auto const& sma = ldata_p->state.const_arrays();
+      auto const& dma = ldata_p->diff_cc.arrays();
+      auto const& vma = ldata_p->visc_cc.arrays();
+      const int do_cp = (m_do_les) ? 1 : 0;
+      auto const& cma = (do_cp) ? ldata_p->cp_cc.arrays() : ldata_p->visc_cc.arrays();   // Dummy if no cp
+#ifdef PELE_USE_EFIELD
+      auto const& kma = ldata_p->mob_cc.arrays();
+      GpuArray<Real,NUM_SPECIES> mwt{0.0};
+      {
+        auto eos = pele::physics::PhysicsType::eos();
+        eos.molecular_weight(mwt.arr);
+      }
+#endif
+
+      const amrex::Real Sc_inv = m_Schmidt_inv;
+      const amrex::Real Pr_inv = m_Prandtl_inv;
+      const int do_unity_le = m_unity_Le;
+      const int do_soret = m_use_soret;
+      const int do_table = m_use_transTable;
+      const TransportTableView tview = (do_table) ? getTransportTableView(*m_transTable)
+                                                  : TransportTableView{};
+      amrex::ParallelFor(ldata_p->diff_cc, ldata_p->diff_cc.nGrowVect(), [=]
+      AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept
+      {
+         if (do_table && !do_unity_le) {
+            getTransportCoeffTable( i, j, k,
+                                    Array4<Real const>(sma[box_no],FIRSTSPEC),
+                                    Array4<Real const>(sma[box_no],TEMP),
+                                    Array4<Real      >(dma[box_no],0),
+                                    Array4<Real      >(dma[box_no],NUM_SPECIES),
+                                    Array4<Real      >(dma[box_no],NUM_SPECIES+1),
+                                    tview);
+            vma[box_no](i,j,k) = dma[box_no](i,j,k,NUM_SPECIES+1);
+            if (do_cp) {
+               getCpmixGivenRYT( i, j, k,
+                                 Array4<Real const>(sma[box_no],DENSITY),
+                                 Array4<Real const>(sma[box_no],FIRSTSPEC),
+                                 Array4<Real const>(sma[box_no],TEMP),
+                                 Array4<Real      >(cma[box_no],0));
+            }
+         } else if (do_table) {
+            // Unity Le: same tabulated viscosity as calcViscosity
+            getTransportCoeffUnityLeTable( i, j, k, do_cp, Sc_inv, Pr_inv,
+                                           Array4<Real const>(sma[box_no],FIRSTSPEC),
+                                           Array4<Real const>(sma[box_no],TEMP),
+                                           Array4<Real      >(dma[box_no],0),
+                                           Array4<Real      >(dma[box_no],NUM_SPECIES),
+                                           Array4<Real      >(dma[box_no],NUM_SPECIES+1),
+                                           Array4<Real      >(vma[box_no],0),
+                                           Array4<Real      >(cma[box_no],0),
+                                           tview);
+         } else {
+            getTransportCoeffFused( i, j, k, do_unity_le, do_soret, do_cp, Sc_inv, Pr_inv,
+                                    Array4<Real const>(sma[box_no],FIRSTSPEC),
+                                    Array4<Real const>(sma[box_no],TEMP),
+                                    Array4<Real      >(dma[box_no],0),
+                                    Array4<Real      >(dma[box_no],NUM_SPECIES),
+                                    Array4<Real      >(dma[box_no],NUM_SPECIES+1),
+                                    (do_soret) ? Array4<Real>(dma[box_no],NUM_SPECIES+2)
+                                               : Array4<Real>(dma[box_no],0),           // Dummy if no Soret
+                                    Array4<Real      >(vma[box_no],0),
+                                    Array4<Real      >(cma[box_no],0),
+                                    ltransparm);
+         }
+#ifdef PELE_USE_EFIELD
+         getKappaSp( i, j, k, mwt.arr, zk,
+                     Array4<Real const>(sma[box_no],FIRSTSPEC),
+                     Array4<Real      >(dma[box_no],0),
+                     Array4<Real const>(sma[box_no],TEMP),
+                     Array4<Real      >(kma[box_no],0));
+#endif
+      });
+      if (do_cp) {
+         ldata_p->cp_time = getTime(lev,a_time);
+      }
+   }
+   Gpu::streamSynchronize();
+
+   // Accuracy of the tabulated properties
+   if (m_use_transTable && !m_unity_Le) {
+      checkTransportTable(a_time);
+   }
+}
+
 void PeleLM::calcViscosity(const TimeStamp &a_time) {
    BL_PROFILE("PeleLM::calcViscosity()");
 
@@ -224,6 +359,8 @@ void PeleLM::calcViscosity(const TimeStamp &a_time) {
 
       auto ldata_p = getLevelDataPtr(lev,a_time);
 
+      invalidateFaceCoeffCache(lev, &ldata_p->visc_cc);
+
       if (m_incompressible) {
          ldata_p->visc_cc.setVal(m_mu);
       } else {
@@ -235,15 +372,28 @@ void PeleLM::calcViscosity(const TimeStamp &a_time) {
          auto const& sma = ldata_p->state.const_arrays();
          auto const& vma = ldata_p->visc_cc.arrays();
 
-         amrex::ParallelFor(ldata_p->visc_cc, ldata_p->visc_cc.nGrowVect(), [=]
-         AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept
-         {
-            getVelViscosity( i, j, k,
-                             Array4<Real const>(sma[box_no],FIRSTSPEC),
-                             Array4<Real      >(sma[box_no],TEMP),
-                             Array4<Real      >(vma[box_no],0),
-                             ltransparm);
-         });
+         if (m_use_transTable) {
+            const TransportTableView tview = getTransportTableView(*m_transTable);
+            amrex::ParallelFor(ldata_p->visc_cc, ldata_p->visc_cc.nGrowVect(), [=]
+            AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept
+            {
+               getVelViscosityTable( i, j, k,
+                                     Array4<Real const>(sma[box_no],FIRSTSPEC),
+                                     Array4<Real const>(sma[box_no],TEMP),
+                                     Array4<Real      >(vma[box_no],0),
+                                     tview);
+            });
+         } else {
+            amrex::ParallelFor(ldata_p->visc_cc, ldata_p->visc_cc.nGrowVect(), [=]
+            AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept
+            {
+               getVelViscosity( i, j, k,
+                                Array4<Real const>(sma[box_no],FIRSTSPEC),
+                                Array4<Real      >(sma[box_no],TEMP),
+                                Array4<Real      >(vma[box_no],0),
+                                ltransparm);
+            });
+         }
       }
    }
    Gpu::streamSynchronize();
@@ -256,6 +406,8 @@ void PeleLM::calcDiffusivity(const TimeStamp &a_time) {
 
       auto ldata_p = getLevelDataPtr(lev,a_time);
 
+      invalidateFaceCoeffCache(lev, &ldata_p->diff_cc);
+
       // Transport data pointer
       auto const* ltransparm = trans_parms.device_trans_parm();
 
@@ -275,10 +427,21 @@ void PeleLM::calcDiffusivity(const TimeStamp &a_time) {
       const amrex::Real Pr_inv = m_Prandtl_inv;
       const int do_unity_le = m_unity_Le;
       const int do_soret = m_use_soret;
+      const int do_table = m_use_transTable;
+      const TransportTableView tview = (do_table) ? getTransportTableView(*m_transTable)
+                                                  : TransportTableView{};
       amrex::ParallelFor(ldata_p->diff_cc, ldata_p->diff_cc.nGrowVect(), [=]
       AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept
       {
-         if (do_soret) {
+         if (do_table && !do_unity_le) {
+           getTransportCoeffTable( i, j, k,
+                                   Array4<Real const>(sma[box_no],FIRSTSPEC),
+                                   Array4<Real const>(sma[box_no],TEMP),
+                                   Array4<Real      >(dma[box_no],0),
+                                   Array4<Real      >(dma[box_no],NUM_SPECIES),
+                                   Array4<Real      >(dma[box_no],NUM_SPECIES+1),
+                                   tview);
+         } else if (do_soret) {
            getTransportCoeffSoret( i, j, k,
                                   Array4<Real const>(sma[box_no],FIRSTSPEC),
                                   Array4<Real const>(sma[box_no],TEMP),
@@ -289,7 +452,18 @@ void PeleLM::calcDiffusivity(const TimeStamp &a_time) {
                                   ltransparm);
 
          } else {
-           if (do_unity_le) {
+           if (do_unity_le && do_table) {
+             // Same tabulated viscosity as calcViscosity, written to diff_cc only
+             getTransportCoeffUnityLeTable( i, j, k, 0, Sc_inv, Pr_inv,
+                                            Array4<Real const>(sma[box_no],FIRSTSPEC),
+                                            Array4<Real const>(sma[box_no],TEMP),
+                                            Array4<Real      >(dma[box_no],0),
+                                            Array4<Real      >(dma[box_no],NUM_SPECIES),
+                                            Array4<Real      >(dma[box_no],NUM_SPECIES+1),
+                                            Array4<Real      >(dma[box_no],NUM_SPECIES+1),
+                                            Array4<Real      >(dma[box_no],NUM_SPECIES+1),
+                                            tview);
+           } else if (do_unity_le) {
              getTransportCoeffUnityLe( i, j, k, Sc_inv, Pr_inv,
                                        Array4<Real const>(sma[box_no],FIRSTSPEC),
                                        Array4<Real const>(sma[box_no],TEMP),
@@ -317,6 +491,148 @@ void PeleLM::calcDiffusivity(const TimeStamp &a_time) {
       });
    }
    Gpu::streamSynchronize();
+
+   // Accuracy of the tabulated properties
+   if (m_use_transTable && !m_unity_Le) {
+      checkTransportTable(a_time);
+   }
+}
+
+void PeleLM::buildTransportTable()
+{
+   BL_PROFILE("PeleLM::buildTransportTable()");
+
+   auto& tab = *m_transTable;
+   const int nPts = tab.nPts;
+   constexpr int nSq = NUM_SPECIES * NUM_SPECIES;
+   tab.mu.resize(nPts*NUM_SPECIES);
+   tab.lambda.resize(nPts*NUM_SPECIES);
+   tab.PD.resize(static_cast<Long>(nPts)*nSq);
+   Real* mu     = tab.mu.data();
+   Real* lambda = tab.lambda.data();
+   Real* PD     = tab.PD.data();
+   const Real Tmin = tab.Tmin;
+   const Real dT = (tab.Tmax - tab.Tmin) / (nPts - 1);
+
+   // Transport data pointer
+   auto const* ltransparm = trans_parms.device_trans_parm();
+
+   // Evaluate each pure species j at 1 atm: the mixture viscosity and conductivity
+   // reduce to those of the species, and the mixture-averaged rho*D of any other
+   // species n to rho_j W_n/W_j D_nj, from which P*D_nj (function of T only) is stored
+   amrex::ParallelFor(nPts*NUM_SPECIES, [=]
+   AMREX_GPU_DEVICE (int idx) noexcept
+   {
+      const int iT = idx / NUM_SPECIES;
+      const int sp = idx % NUM_SPECIES;
+      Real Tloc = Tmin + iT * dT;
+      Real y[NUM_SPECIES] = {0.0};
+      y[sp] = 1.0;
+
+      auto eos = pele::physics::PhysicsType::eos();
+      Real mwt[NUM_SPECIES] = {0.0};
+      eos.molecular_weight(mwt);
+      Real P_cgs = 1013250.0;
+      Real rho_cgs = 0.0;
+      eos.PYT2R(P_cgs, y, Tloc, rho_cgs);
+
+      Real rhoDi_cgs[NUM_SPECIES] = {0.0};
+      Real dummy_chi[NUM_SPECIES] = {0.0};
+      Real lambda_cgs = 0.0;
+      Real mu_cgs = 0.0;
+      Real dummy_xi = 0.0;
+      bool get_xi = false;
+      bool get_mu = true;
+      bool get_lam = true;
+      bool get_Ddiag = true;
+      bool get_chi = false;
+      auto trans = pele::physics::PhysicsType::transport();
+      trans.transport(get_xi, get_mu, get_lam, get_Ddiag, get_chi, Tloc,
+                      rho_cgs, y, rhoDi_cgs, dummy_chi, mu_cgs, dummy_xi, lambda_cgs, ltransparm);
+
+      mu[iT*NUM_SPECIES+sp] = mu_cgs;
+      lambda[iT*NUM_SPECIES+sp] = lambda_cgs;
+      for (int n = 0; n < NUM_SPECIES; n++) {
+         PD[iT*nSq+n*NUM_SPECIES+sp] = (n == sp) ? 0.0
+                                     : P_cgs * rhoDi_cgs[n] * mwt[sp] / (mwt[n] * rho_cgs);
+      }
+   });
+   Gpu::streamSynchronize();
+
+   if (m_verbose) {
+      const Real tabMB = static_cast<Real>((tab.mu.size()+tab.lambda.size()+tab.PD.size())*sizeof(Real))/(1024.0*1024.0);
+      Print() << "    Tabulated transport: " << nPts << " points in [" << tab.Tmin << "," << tab.Tmax
+              << "] K, " << ((tab.cubic) ? "cubic" : "linear") << " interpolation, " << tabMB << " MB\n";
+   }
+}
+
+void PeleLM::checkTransportTable(const TimeStamp &a_time)
+{
+   if (m_transTableCheckInt <= 0 ||
+       m_nstep % m_transTableCheckInt != 0 ||
+       m_nstep == m_transTableLastCheck) return;
+   m_transTableLastCheck = m_nstep;
+
+   BL_PROFILE("PeleLM::checkTransportTable()");
+
+   // Transport data pointer
+   auto const* ltransparm = trans_parms.device_trans_parm();
+   const int stride = m_transTableCheckStride;
+
+   // Max relative errors on rhoD, lambda and mu
+   Vector<Real> errMax(3,0.0);
+   for (int lev = 0; lev <= finest_level; ++lev) {
+
+      auto ldata_p = getLevelDataPtr(lev,a_time);
+
+      MultiFab exact(grids[lev], dmap[lev], NUM_SPECIES+2, 0);
+      auto const& sma = ldata_p->state.const_arrays();
+      auto const& dma = ldata_p->diff_cc.const_arrays();
+      auto const& ema = exact.arrays();
+      auto err = ParReduce(TypeList<ReduceOpMax,ReduceOpMax,ReduceOpMax>{},
+                           TypeList<Real,Real,Real>{}, exact, IntVect(0),
+      [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept
+          -> GpuTuple<Real,Real,Real>
+      {
+         if (i % stride != 0 || j % stride != 0 || k % stride != 0) {
+            return GpuTuple<Real,Real,Real>{0.0, 0.0, 0.0};
+         }
+         getTransportCoeff( i, j, k,
+                            Array4<Real const>(sma[box_no],FIRSTSPEC),
+                            Array4<Real const>(sma[box_no],TEMP),
+                            Array4<Real      >(ema[box_no],0),
+                            Array4<Real      >(ema[box_no],NUM_SPECIES),
+                            Array4<Real      >(ema[box_no],NUM_SPECIES+1),
+                            ltransparm);
+         auto const& ex  = ema[box_no];
+         auto const& tab = dma[box_no];
+         auto relErr = [] (Real a, Real b) {
+            return amrex::Math::abs(a - b) / amrex::max(amrex::Math::abs(b), 1.0e-200);
+         };
+         Real errD = 0.0;
+         for (int n = 0; n < NUM_SPECIES; n++) {
+            errD = amrex::max(errD, relErr(tab(i,j,k,n), ex(i,j,k,n)));
+         }
+         return GpuTuple<Real,Real,Real>{errD,
+                                         relErr(tab(i,j,k,NUM_SPECIES), ex(i,j,k,NUM_SPECIES)),
+                                         relErr(tab(i,j,k,NUM_SPECIES+1), ex(i,j,k,NUM_SPECIES+1))};
+      });
+      errMax[0] = std::max(errMax[0], amrex::get<0>(err));
+      errMax[1] = std::max(errMax[1], amrex::get<1>(err));
+      errMax[2] = std::max(errMax[2], amrex::get<2>(err));
+   }
+   ParallelDescriptor::ReduceRealMax(errMax.data(), 3);
+
+   Print() << " Tabulated transport max. relative error (1/" << stride
+           << " cells): rhoD " << errMax[0]
+           << ", lambda " << errMax[1]
+           << ", mu " << errMax[2] << "\n";
+
+   const Real errMaxAll = *std::max_element(errMax.begin(), errMax.end());
+   if (errMaxAll > m_transTableCheckTol) {
+      amrex::Abort("Tabulated transport error " + std::to_string(errMaxAll) +
+                   " exceeds peleLM.transport_table_check_tol: refine the table or widen its temperature range");
+   }
 }
 
 Array<MultiFab,AMREX_SPACEDIM>
@@ -330,6 +646,46 @@ PeleLM::getDiffusivity(int lev, int beta_comp, int ncomp, int doZeroVisc,
    AMREX_ASSERT(bcrec.size() >= ncomp);
    AMREX_ASSERT(beta_cc.nComp() >= beta_comp+ncomp);
 
+   // Get the turbulent contribution time stamp first, since updating the
+   // turbulent viscosity invalidates the cached coefficients.
+   // If initializing the simulation, always recompute turbulent viscosity
+   // otherwise, only recompute once per level per timestep (at old time)
+   // calcTurbViscosity computes for all levels, so only call from the base level
+   TimeStamp tstamp = AmrOldTime;
+   if (addTurbContrib and m_do_les) {
+     if (getTime(lev, AmrNewTime) == 0.0 ) {
+       tstamp = AmrNewTime;
+       if (lev == 0) {
+         calcTurbViscosity(tstamp);
+       }
+     } else if (lev == 0 and getTime(lev, AmrOldTime) > m_turb_visc_time[lev]) {
+       tstamp = AmrOldTime;
+       calcTurbViscosity(tstamp);
+       m_turb_visc_time[lev] = getTime(lev, AmrOldTime);
+     }
+   }
+
+   // Only the LevelData transport coefficients, invalidated when recomputed, are cached
+   bool useCache = false;
+   if (m_use_faceCoeffCache) {
+      for (const auto& ldata : {m_leveldata_old[lev].get(), m_leveldata_new[lev].get()}) {
+         if (&beta_cc == &ldata->diff_cc || &beta_cc == &ldata->visc_cc) useCache = true;
+      }
+   }
+   if (useCache) {
+      for (const auto& entry : m_faceCoeffCache[lev]) {
+         if (entry->src == &beta_cc && entry->beta_comp == beta_comp && entry->ncomp == ncomp &&
+             entry->doZeroVisc == doZeroVisc && entry->addTurbContrib == addTurbContrib &&
+             entry->srcBA == beta_cc.boxArray() && entry->srcDM == beta_cc.DistributionMap() &&
+             std::equal(bcrec.begin(), bcrec.begin()+ncomp, entry->bcrec.begin())) {
+            // Return aliases to the cached data
+            return Array<MultiFab,AMREX_SPACEDIM>{AMREX_D_DECL(MultiFab(entry->coeff_ec[0],amrex::make_alias,0,ncomp),
+                                                               MultiFab(entry->coeff_ec[1],amrex::make_alias,0,ncomp),
+                                                               MultiFab(entry->coeff_ec[2],amrex::make_alias,0,ncomp))};
+         }
+      }
+   }
+
    const auto& ba = beta_cc.boxArray();
    const auto& dm = beta_cc.DistributionMap();
    const auto& factory = beta_cc.Factory();
@@ -383,22 +739,6 @@ PeleLM::getDiffusivity(int lev, int beta_comp, int ncomp, int doZeroVisc,
    // If PELE_USE_EFIELD is active, these relationships will not hold and LES is not supported
    if (addTurbContrib and m_do_les) {
 
-     // If initializing the simulation, always recompute turbulent viscosity
-     // otherwise, only recompute once per level per timestep (at old time)
-     // calcTurbViscosity computes for all levels, so only call from the base level
-     TimeStamp tstamp;
-     if (getTime(lev, AmrNewTime) == 0.0 ) {
-       tstamp = AmrNewTime;
-       if (lev == 0) {
-         calcTurbViscosity(tstamp);
-       }
-     } else if (lev == 0 and getTime(lev, AmrOldTime) > m_turb_visc_time[lev]) {
-       tstamp = AmrOldTime;
-       calcTurbViscosity(tstamp);
-       m_turb_visc_time[lev] = getTime(lev, AmrOldTime);
-     } else {
-       tstamp = AmrOldTime;
-     }
      auto ldata_p = getLevelDataPtr(lev,tstamp);
 
      // Identify and add the correct turbulent contribution
@@ -436,5 +776,55 @@ PeleLM::getDiffusivity(int lev, int beta_comp, int ncomp, int doZeroVisc,
       }
    }
 
+   if (useCache) {
+      auto entry = std::make_unique<FaceCoeffCacheEntry>();
+      entry->src = &beta_cc;
+      entry->beta_comp = beta_comp;
+      entry->ncomp = ncomp;
+      entry->doZeroVisc = doZeroVisc;
+      entry->addTurbContrib = addTurbContrib;
+      entry->bcrec.assign(bcrec.begin(), bcrec.begin()+ncomp);
+      entry->srcBA = beta_cc.boxArray();
+      entry->srcDM = beta_cc.DistributionMap();
+      entry->coeff_ec = std::move(beta_ec);
+      m_faceCoeffCache[lev].push_back(std::move(entry));
+      const auto& cached = m_faceCoeffCache[lev].back()->coeff_ec;
+      return Array<MultiFab,AMREX_SPACEDIM>{AMREX_D_DECL(MultiFab(cached[0],amrex::make_alias,0,ncomp),
+                                                         MultiFab(cached[1],amrex::make_alias,0,ncomp),
+                                                         MultiFab(cached[2],amrex::make_alias,0,ncomp))};
+   }
+
    return beta_ec;
 }
+
+void
+PeleLM::invalidateFaceCoeffCache(int lev,
+                                 const MultiFab* a_src)
+{
+   if (lev >= static_cast<int>(m_faceCoeffCache.size())) return;
+   auto& cache = m_faceCoeffCache[lev];
+   if (a_src == nullptr) {
+      cache.clear();
+   } else {
+      cache.erase(std::remove_if(cache.begin(), cache.end(),
+                                 [a_src](const std::unique_ptr<FaceCoeffCacheEntry>& entry)
+                                 { return entry->src == a_src; }),
+                  cache.end());
+   }
+}
+
+Long
+PeleLM::faceCoeffCacheBytes()
+{
+   Long bytes = 0;
+   for (const auto& cache : m_faceCoeffCache) {
+      for (const auto& entry : cache) {
+         for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+            for (MFIter mfi(entry->coeff_ec[idim]); mfi.isValid(); ++mfi) {
+               bytes += entry->coeff_ec[idim][mfi].nBytes();
+            }
+         }
+      }
+   }
+   return bytes;
+}
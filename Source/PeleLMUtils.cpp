@@ -802,10 +802,10 @@ PeleLM::derive(const std::string &a_name,
 
    if (rec) {        // This is a derived variable
       mf.reset(new MultiFab(grids[lev], dmap[lev], rec->numDerive(), nGrow, MFInfo(), Factory(lev)));
-      std::unique_ptr<MultiFab> statemf = fillPatchState(lev, a_time, m_nGrowState);
+      const MultiFab& statemf = fillPatchStateCached(lev, a_time, m_nGrowState);
       // Get pressure: TODO no fillpatch for pressure just yet, simply get new state
       auto ldata_p = getLevelDataPtr(lev,AmrNewTime);
-      std::unique_ptr<MultiFab> reactmf = fillPatchReact(lev, a_time, nGrow);
+      const MultiFab& reactmf = fillPatchReactCached(lev, a_time, nGrow);
       auto stateBCs = fetchBCRecArray(VELX,NVAR);
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
@@ -814,21 +814,24 @@ PeleLM::derive(const std::string &a_name,
       {
           const Box& bx = mfi.growntilebox(nGrow);
           FArrayBox& derfab = (*mf)[mfi];
-          FArrayBox const& statefab = (*statemf)[mfi];
-          FArrayBox const& reactfab = (m_incompressible) ? ldata_p->press[mfi] : (*reactmf)[mfi];
+          FArrayBox const& statefab = statemf[mfi];
+          FArrayBox const& reactfab = (m_incompressible) ? ldata_p->press[mfi] : reactmf[mfi];
           FArrayBox const& pressfab = ldata_p->press[mfi];
           rec->derFunc()(this, bx, derfab, 0, rec->numDerive(), statefab, reactfab, pressfab, geom[lev], a_time, stateBCs, lev);
       }
+      if (isSampleDumpVar(a_name)) {
+         sampleDump(a_name, lev, a_time, *mf, statemf);
+      }
    } else if (isStateVariable(a_name)) {          // This is a state variable
       mf.reset(new MultiFab(grids[lev], dmap[lev], 1, nGrow, MFInfo(), Factory(lev)));
       int idx = stateVariableIndex(a_name);
-      std::unique_ptr<MultiFab> statemf = fillPatchState(lev, a_time, nGrow);
-      MultiFab::Copy(*mf,*statemf,idx,0,1,nGrow);
+      const MultiFab& statemf = fillPatchStateCached(lev, a_time, nGrow);
+      MultiFab::Copy(*mf,statemf,idx,0,1,nGrow);
    } else {                                       // This is a reaction variable
       mf.reset(new MultiFab(grids[lev], dmap[lev], 1, nGrow, MFInfo(), Factory(lev)));
       int idx = reactVariableIndex(a_name);
-      std::unique_ptr<MultiFab> reactmf = fillPatchReact(lev, a_time, nGrow);
-      MultiFab::Copy(*mf,*reactmf,idx,0,1,nGrow);
+      const MultiFab& reactmf = fillPatchReactCached(lev, a_time, nGrow);
+      MultiFab::Copy(*mf,reactmf,idx,0,1,nGrow);
    }
 
    return mf;
@@ -858,10 +861,10 @@ PeleLM::deriveComp(const std::string &a_name,
 
    if (rec) {        // This is a derived variable
       mf.reset(new MultiFab(grids[lev], dmap[lev], 1, nGrow, MFInfo(), Factory(lev)));
-      std::unique_ptr<MultiFab> statemf = fillPatchState(lev, a_time, m_nGrowState);
+      const MultiFab& statemf = fillPatchStateCached(lev, a_time, m_nGrowState);
       // Get pressure: TODO no fillpatch for pressure just yet, simply get new state
       auto ldata_p = getLevelDataPtr(lev,AmrNewTime);
-      std::unique_ptr<MultiFab> reactmf = fillPatchReact(lev, a_time, nGrow);
+      const MultiFab& reactmf = fillPatchReactCached(lev, a_time, nGrow);
       auto stateBCs = fetchBCRecArray(VELX,NVAR);
 
       // Temp MF for all the derive components
@@ -873,8 +876,8 @@ PeleLM::deriveComp(const std::string &a_name,
       {
           const Box& bx = mfi.growntilebox(nGrow);
           FArrayBox& derfab = derTemp[mfi];
-          FArrayBox const& statefab = (*statemf)[mfi];
-          FArrayBox const& reactfab = (m_incompressible) ? ldata_p->press[mfi] : (*reactmf)[mfi];
+          FArrayBox const& statefab = statemf[mfi];
+          FArrayBox const& reactfab = (m_incompressible) ? ldata_p->press[mfi] : reactmf[mfi];
           FArrayBox const& pressfab = ldata_p->press[mfi];
           rec->derFunc()(this, bx, derfab, 0, rec->numDerive(), statefab, reactfab, pressfab, geom[lev], a_time, stateBCs, lev);
       }
@@ -887,13 +890,13 @@ PeleLM::deriveComp(const std::string &a_name,
    } else if (isStateVariable(a_name)) {          // This is a state variable
       mf.reset(new MultiFab(grids[lev], dmap[lev], 1, nGrow, MFInfo(), Factory(lev)));
       int idx = stateVariableIndex(a_name);
-      std::unique_ptr<MultiFab> statemf = fillPatchState(lev, a_time, nGrow);
-      MultiFab::Copy(*mf,*statemf,idx,0,1,nGrow);
+      const MultiFab& statemf = fillPatchStateCached(lev, a_time, nGrow);
+      MultiFab::Copy(*mf,statemf,idx,0,1,nGrow);
    } else {                                       // This is a reaction variable
       mf.reset(new MultiFab(grids[lev], dmap[lev], 1, nGrow, MFInfo(), Factory(lev)));
       int idx = reactVariableIndex(a_name);
-      std::unique_ptr<MultiFab> reactmf = fillPatchReact(lev, a_time, nGrow);
-      MultiFab::Copy(*mf,*reactmf,idx,0,1,nGrow);
+      const MultiFab& reactmf = fillPatchReactCached(lev, a_time, nGrow);
+      MultiFab::Copy(*mf,reactmf,idx,0,1,nGrow);
    }
 
    return mf;
@@ -970,6 +973,50 @@ PeleLM::initProgressVariable()
     }
 }
 
+void
+PeleLM::initReactionStoichiometry()
+{
+    // Gather the (species, coefficient) pairs of each reaction once, in the
+    // internal reaction ordering used by comp_qfqr, such that per-cell kernels
+    // only perform a sparse mat-vec instead of calling CKINU/GET_RMAP
+    int nspecMax = 0;
+    CKINU(0, nspecMax, nullptr, nullptr);
+    Vector<int> ki(std::max(nspecMax,1),0);
+    Vector<int> nu(std::max(nspecMax,1),0);
+    Vector<int> rmap(std::max(NUM_REACTIONS,1),0);
+    if (NUM_REACTIONS > 0) {
+        GET_RMAP(rmap.data());
+    }
+
+    Vector<int> rowPtr(NUM_REACTIONS+1,0);
+    Vector<int> specIdx;
+    Vector<Real> coef;
+    specIdx.reserve(NUM_REACTIONS*nspecMax);
+    coef.reserve(NUM_REACTIONS*nspecMax);
+    for (int n = 0; n < NUM_REACTIONS; ++n) {
+        int nspec = 0;
+        CKINU(rmap[n]+1, nspec, ki.data(), nu.data());
+        for (int m = 0; m < nspec; ++m) {
+            specIdx.push_back(ki[m]-1);
+            coef.push_back(static_cast<Real>(nu[m]));
+        }
+        rowPtr[n+1] = static_cast<int>(specIdx.size());
+    }
+
+    m_stoichRowPtr.resize(rowPtr.size());
+    Gpu::copy(Gpu::hostToDevice, rowPtr.begin(), rowPtr.end(), m_stoichRowPtr.begin());
+    m_stoichSpecIdx.resize(specIdx.size());
+    Gpu::copy(Gpu::hostToDevice, specIdx.begin(), specIdx.end(), m_stoichSpecIdx.begin());
+    m_stoichCoef.resize(coef.size());
+    Gpu::copy(Gpu::hostToDevice, coef.begin(), coef.end(), m_stoichCoef.begin());
+    Gpu::streamSynchronize();
+
+    if (m_verbose > 1) {
+        Print() << " Reaction stoichiometry table: " << NUM_REACTIONS << " reactions, "
+                << specIdx.size() << " non-zero entries\n";
+    }
+}
+
 void
 PeleLM::parseVars(const Vector<std::string> &a_varsNames,
                   const Vector<std::string> &a_stringIn,
@@ -1549,6 +1596,11 @@ PeleLM::checkMemory(const std::string &a_message)
     ParallelDescriptor::ReduceLongMax(max_fab_megabytes, IOProc);
     Print() << "     [" << a_message << "] MFs mem. allocated (MB) " << max_fab_megabytes << "\n";
 #endif
+    if (m_use_faceCoeffCache) {
+       Long cache_megabytes = faceCoeffCacheBytes() / (1024*1024);
+       ParallelDescriptor::ReduceLongMax(cache_megabytes, IOProc);
+       Print() << "     [" << a_message << "] Face coeffs. cache (MB) " << cache_megabytes << "\n";
+    }
 }
 
 void
@@ -2,6 +2,20 @@
 
 using namespace amrex;
 
+namespace {
+// Asynchronous output relies on the AMReX background I/O thread, which has
+// to be requested before AMReX initializes
+void add_par () {
+   ParmParse pp("amr");
+   int async_output = 0;
+   pp.query("async_output",async_output);
+   ParmParse ppa("amrex");
+   if (async_output && !ppa.contains("async_out")) {
+      ppa.add("async_out",1);
+   }
+}
+}
+
 int main(int argc, char* argv[]) {
 
    // check to see if it contains --describe
@@ -15,7 +29,7 @@ int main(int argc, char* argv[]) {
    }
 
    // in AMReX.cpp
-   Initialize(argc, argv);
+   Initialize(argc, argv, true, MPI_COMM_WORLD, add_par);
 
    // Refuse to continue if we did not provide an inputs file.
    if (argc <= 1) {